@@ -41,6 +41,12 @@ namespace lsp
 
             protected:
                 lltl::darray<float>     vItems;
+                const float            *pExternal;      // Attached external buffer
+                size_t                  nExtSize;       // Size of the external buffer
+                size_t                  nVersion;       // Version of the data
+
+            protected:
+                void                modified();
 
             protected:
                 explicit FloatArray(prop::Listener *listener = NULL);
@@ -51,19 +57,31 @@ namespace lsp
                  * Get all values stored in the raw array
                  * @return pointer to all values, may be NULL for empty array
                  */
-                inline const float *values() const          { return vItems.array();        }
+                inline const float *values() const          { return (pExternal != NULL) ? pExternal : vItems.array();  }
 
                 /**
                  * Get size of the array in elements
                  * @return size of the array in elements
                  */
-                inline size_t       size() const            { return vItems.size();         }
+                inline size_t       size() const            { return (pExternal != NULL) ? nExtSize : vItems.size();    }
 
                 /**
                  * Get capacity of the array
                  * @return capacity
                  */
-                inline size_t       capacity() const        { return vItems.capacity();     }
+                inline size_t       capacity() const        { return (pExternal != NULL) ? nExtSize : vItems.capacity();}
+
+                /**
+                 * Get version of the data, the version changes on each modification of the array
+                 * @return version of the data
+                 */
+                inline size_t       version() const         { return nVersion;              }
+
+                /**
+                 * Check that the array is attached to the external buffer
+                 * @return true if the array is attached to the external buffer
+                 */
+                inline bool         attached() const        { return pExternal != NULL;     }
 
                 /**
                  * Get the value by specified index
@@ -73,6 +91,30 @@ namespace lsp
                 float               get(size_t index) const;
 
             public:
+                /**
+                 * Attach the externally owned buffer to the array without copying the data.
+                 * The buffer should remain valid until the array is detached, re-attached or
+                 * destroyed. After modification of the buffer contents, touch() should be
+                 * called to notify listeners. Any modifying call except set() and clear()
+                 * copies the external data into own storage of the array first.
+                 *
+                 * @param v pointer to the external buffer
+                 * @param count number of elements in the buffer
+                 * @return status of operation
+                 */
+                status_t            attach(const float *v, size_t count);
+
+                /**
+                 * Detach the external buffer: copy it's contents into own storage of the array
+                 * @return status of operation
+                 */
+                status_t            detach();
+
+                /**
+                 * Notify listeners that the data has been modified in place
+                 */
+                inline void         touch()                                 { modified();                       }
+
                 /**
                  * Clear the collection, trims the array to 0 elements
                  */
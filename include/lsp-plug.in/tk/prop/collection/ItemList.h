@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_TK_PROP_COLLECTION_ITEMLIST_H_
+#define LSP_PLUG_IN_TK_PROP_COLLECTION_ITEMLIST_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * List of lightweight data items. Each item stores only the raw text, the tag,
+         * the set of flags (see item_flags_t) and optional color overrides. All visual
+         * properties are taken from the single item style shared by the owning widget,
+         * so the list of thousands of entries costs bytes per item instead of the full
+         * widget with it's own style, slots and bound properties.
+         */
+        class ItemList: public Property
+        {
+            private:
+                ItemList & operator = (const ItemList &);
+                ItemList(const ItemList &);
+
+            public:
+                typedef struct item_t
+                {
+                    char               *sText;          // Raw UTF-8 text of the item
+                    ssize_t             nTag;           // Tag of the item
+                    uint32_t            nFlags;         // Item flags
+                    uint32_t            nBgColor;       // Background color override, RGBA32
+                    uint32_t            nTextColor;     // Text color override, RGBA32
+                } item_t;
+
+            protected:
+                lltl::darray<item_t>    vItems;
+
+            protected:
+                static bool         init_item(item_t *item, const LSPString *text, ssize_t tag, size_t flags);
+                static void         destroy_item(item_t *item);
+                void                do_destroy();
+
+            protected:
+                explicit ItemList(prop::Listener *listener = NULL);
+                virtual ~ItemList();
+
+            public:
+                /**
+                 * Get size of the list
+                 * @return size of the list
+                 */
+                inline size_t       size() const                            { return vItems.size();         }
+
+                /**
+                 * Get raw item by index
+                 * @param index index of the item
+                 * @return pointer to the item or NULL if the bad index has been specified
+                 */
+                inline const item_t *get(size_t index) const               { return vItems.get(index);     }
+
+                /**
+                 * Get raw text of the item
+                 * @param index index of the item
+                 * @return UTF-8 text of the item or NULL if the bad index has been specified
+                 */
+                const char         *text(size_t index) const;
+
+                /**
+                 * Get text of the item
+                 * @param dst destination string to store the text
+                 * @param index index of the item
+                 * @return status of operation
+                 */
+                status_t            get_text(LSPString *dst, size_t index) const;
+
+                /**
+                 * Get tag of the item
+                 * @param index index of the item
+                 * @return tag of the item or -1 if the bad index has been specified
+                 */
+                ssize_t             tag(size_t index) const;
+
+                /**
+                 * Get flags of the item
+                 * @param index index of the item
+                 * @return flags of the item or 0 if the bad index has been specified
+                 */
+                size_t              flags(size_t index) const;
+
+                /**
+                 * Find the item with all specified flags set
+                 * @param flags flags to check
+                 * @param first index of the first item to start search
+                 * @return index of the found item or negative value if not found
+                 */
+                ssize_t             find_flags(size_t flags, size_t first = 0) const;
+
+                /**
+                 * Find the item with specified tag
+                 * @param tag tag to search
+                 * @return index of the found item or negative value if not found
+                 */
+                ssize_t             find_tag(ssize_t tag) const;
+
+                /**
+                 * Get the background color of the item
+                 * @param dst color to store the value
+                 * @param index index of the item
+                 * @return true if the item overrides the background color
+                 */
+                bool                get_bg_color(lsp::Color *dst, size_t index) const;
+
+                /**
+                 * Get the text color of the item
+                 * @param dst color to store the value
+                 * @param index index of the item
+                 * @return true if the item overrides the text color
+                 */
+                bool                get_text_color(lsp::Color *dst, size_t index) const;
+
+            public:
+                /**
+                 * Reserve space for items but do not resize
+                 * @param size number of items to reserve
+                 * @return status of operation
+                 */
+                inline status_t     reserve(size_t size)                    { return (vItems.reserve(size)) ? STATUS_OK : STATUS_NO_MEM;    }
+
+                /**
+                 * Append item to the end of list
+                 * @param text text of the item
+                 * @param tag tag of the item
+                 * @param flags flags of the item
+                 * @return status of operation
+                 */
+                status_t            add(const LSPString *text, ssize_t tag = -1, size_t flags = 0);
+                status_t            add(const char *text, ssize_t tag = -1, size_t flags = 0);
+
+                /**
+                 * Insert item at the specified position
+                 * @param index position to insert the item
+                 * @param text text of the item
+                 * @param tag tag of the item
+                 * @param flags flags of the item
+                 * @return status of operation
+                 */
+                status_t            insert(size_t index, const LSPString *text, ssize_t tag = -1, size_t flags = 0);
+                status_t            insert(size_t index, const char *text, ssize_t tag = -1, size_t flags = 0);
+
+                /**
+                 * Remove the item
+                 * @param index index of the item to remove
+                 * @return status of operation
+                 */
+                status_t            remove(size_t index);
+
+                /**
+                 * Clear the list
+                 */
+                void                clear();
+
+                /**
+                 * Set text of the item
+                 * @param index index of the item
+                 * @param text text to set
+                 * @return status of operation
+                 */
+                status_t            set_text(size_t index, const LSPString *text);
+                status_t            set_text(size_t index, const char *text);
+
+                /**
+                 * Set tag of the item
+                 * @param index index of the item
+                 * @param tag tag to set
+                 * @return status of operation
+                 */
+                status_t            set_tag(size_t index, ssize_t tag);
+
+                /**
+                 * Set flags of the item, color override flags are not affected
+                 * @param index index of the item
+                 * @param flags flags to set
+                 * @param notify notify the owner about the change
+                 * @return status of operation
+                 */
+                status_t            set_flags(size_t index, size_t flags, bool notify = true);
+
+                /**
+                 * Clear specified flags for all items in the list
+                 * @param flags flags to clear
+                 * @param notify notify the owner about the change
+                 * @return true if at least one item has been modified
+                 */
+                bool                clear_flags(size_t flags, bool notify = true);
+
+                /**
+                 * Set the background color override of the item
+                 * @param index index of the item
+                 * @param c color to set, NULL to reset the override
+                 * @return status of operation
+                 */
+                status_t            set_bg_color(size_t index, const lsp::Color *c);
+
+                /**
+                 * Set the text color override of the item
+                 * @param index index of the item
+                 * @param c color to set, NULL to reset the override
+                 * @return status of operation
+                 */
+                status_t            set_text_color(size_t index, const lsp::Color *c);
+
+                /**
+                 * Swap contents with another list
+                 * @param src list to perform swap
+                 */
+                void                swap(ItemList *src);
+                inline void         swap(ItemList &src)                     { swap(&src);                   }
+        };
+
+        namespace prop
+        {
+            class ItemList: public tk::ItemList
+            {
+                private:
+                    ItemList & operator = (const ItemList &);
+                    ItemList(const ItemList &);
+
+                public:
+                    explicit inline ItemList(prop::Listener *listener = NULL): tk::ItemList(listener) {}
+
+                public:
+                    /**
+                     * Destroy the list and free all allocated memory
+                     */
+                    inline void         flush()                             { tk::ItemList::do_destroy();   }
+            };
+        }
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_PROP_COLLECTION_ITEMLIST_H_ */
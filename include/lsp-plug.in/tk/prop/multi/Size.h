@@ -86,6 +86,7 @@ namespace lsp
 
                 static bool         overlap(const ws::rectangle_t *a, const ws::rectangle_t *b);
                 static bool         is_empty(const ws::rectangle_t *r);
+                static bool         equals(const ws::rectangle_t *a, const ws::rectangle_t *b);
 
                 static void         init(ws::rectangle_t *dst, ssize_t left, ssize_t top, ssize_t width, ssize_t height);
         };
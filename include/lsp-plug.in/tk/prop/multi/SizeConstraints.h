@@ -143,6 +143,7 @@ namespace lsp
                 static void scale(ws::size_limit_t *dst, float scale);
 
                 static bool match(const ws::rectangle_t *r, const ws::size_limit_t *sr);
+                static bool equals(const ws::size_limit_t *a, const ws::size_limit_t *b);
         };
 
         namespace prop
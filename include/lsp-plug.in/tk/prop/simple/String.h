@@ -33,10 +33,15 @@ namespace lsp
 {
     namespace tk
     {
+        class StringCache;
+
         /**
          * A localized string that requires access to dictionary to resolve the actual
          * localized string value. There is also possible to define raw text without
          * access to the dictionary.
+         *
+         * Change of the language or parameters only marks the formatted value as dirty,
+         * the actual formatting is performed when the value is requested by the widget.
          */
         class String: public SimpleProperty
         {
@@ -75,6 +80,8 @@ namespace lsp
                 status_t            fmt_internal(LSPString *out, const LSPString *lang) const;
                 LSPString          *fmt_for_update();
                 status_t            lookup_template(LSPString *templ, const LSPString *lang) const;
+                status_t            fmt_template(LSPString *out, const LSPString *lang, bool fmt_key) const;
+                StringCache        *string_cache() const;
 
             protected:
                 status_t            bind(atom_t property, Style *style, i18n::IDictionary *dict);
@@ -61,6 +61,10 @@ namespace lsp
                 size_t          nStride;
                 bool            bStrobe;
                 uint8_t        *pPtr;
+                size_t          nVersion;           // Version of the data
+                const float    *vExtX;              // Attached external buffer of horizontal coordinates
+                const float    *vExtY;              // Attached external buffer of vertical coordinates
+                const float    *vExtS;              // Attached external buffer of strobes
 
                 atom_t          vAtoms[P_COUNT];    // Atoms
                 Listener        sListener;          // Listener
@@ -82,16 +86,18 @@ namespace lsp
 
             public:
                 inline size_t       size() const                { return nSize;                                 }
-                inline size_t       capacity() const            { return nStride*(2 + bStrobe);                 }
-                inline bool         valid() const               { return vData != NULL;                         }
+                inline size_t       capacity() const            { return (vExtX != NULL) ? nSize*(2 + bStrobe) : nStride*(2 + bStrobe); }
+                inline bool         valid() const               { return (vData != NULL) || (vExtX != NULL);    }
                 inline bool         strobe() const              { return bStrobe;                               }
-                inline const float *x() const                   { return vData;                                 }
-                inline const float *y() const                   { return &vData[nStride];                       }
-                inline const float *s() const                   { return (bStrobe) ? &vData[nStride*2] : NULL;  }
+                inline bool         attached() const            { return vExtX != NULL;                         }
+                inline const float *x() const                   { return (vExtX != NULL) ? vExtX : vData;       }
+                inline const float *y() const                   { return (vExtX != NULL) ? vExtY : &vData[nStride]; }
+                inline const float *s() const                   { return (vExtX != NULL) ? vExtS : (bStrobe) ? &vData[nStride*2] : NULL;  }
+                inline size_t       version() const             { return nVersion;                              }
 
-                inline float       *x()                         { return vData;                                 }
-                inline float       *y()                         { return &vData[nStride];                       }
-                inline float       *s()                         { return (bStrobe) ? &vData[nStride*2] : NULL;  }
+                inline float       *x()                         { return (detach()) ? vData : NULL;             }
+                inline float       *y()                         { return (detach()) ? &vData[nStride] : NULL;   }
+                inline float       *s()                         { return (detach() && bStrobe) ? &vData[nStride*2] : NULL;  }
 
                 inline void         touch()                     { sync();                                       }
 
@@ -105,6 +111,28 @@ namespace lsp
                 bool                set_s(const float *v, size_t size);
                 inline bool         set_s(const float *v)       { return set_s(v, nSize);       }
                 bool                set(const float *x, const float *y, size_t size);
+
+                /**
+                 * Attach externally owned buffers to the mesh without copying the data. The buffers
+                 * should remain valid until the mesh is detached, re-attached or destroyed. After
+                 * modification of the buffer contents, touch() should be called to increment the
+                 * version of the data and notify listeners. Obtaining the non-const pointer to the
+                 * data or any modifying call copies the external data into own storage first.
+                 *
+                 * @param x buffer of horizontal coordinates
+                 * @param y buffer of vertical coordinates
+                 * @param s buffer of strobes, NULL if strobes are not used
+                 * @param size number of points in each buffer
+                 * @return true on success
+                 */
+                bool                attach(const float *x, const float *y, const float *s, size_t size);
+                inline bool         attach(const float *x, const float *y, size_t size) { return attach(x, y, NULL, size); }
+
+                /**
+                 * Detach external buffers: copy their contents into own storage
+                 * @return true on success
+                 */
+                bool                detach();
         };
 
         namespace prop
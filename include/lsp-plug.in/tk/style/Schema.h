@@ -26,6 +26,7 @@
     #error "use <lsp-plug.in/tk/tk.h>"
 #endif
 
+#include <lsp-plug.in/lltl/darray.h>
 #include <lsp-plug.in/lltl/parray.h>
 #include <lsp-plug.in/lltl/pphash.h>
 #include <lsp-plug.in/runtime/LSPString.h>
@@ -67,6 +68,8 @@ namespace lsp
                 Schema & operator = (const Schema &);
                 Schema(const Schema &);
 
+                friend class Style;
+
             protected:
                 enum flags_t
                 {
@@ -86,6 +89,13 @@ namespace lsp
                     LSPString           svalue;
                 } property_value_t;
 
+                typedef struct pending_t
+                {
+                    Style              *pStyle;         // Style with pending notifications
+                    size_t              nDepth;         // Depth of the style in the inheritance graph
+                    size_t              nIndex;         // Order of the style in the transaction
+                } pending_t;
+
             protected:
                 mutable Atoms                      *pAtoms;
                 mutable Display                    *pDisplay;
@@ -94,6 +104,13 @@ namespace lsp
                 lltl::pphash<LSPString, Style>      vBuiltin;
                 lltl::pphash<LSPString, Style>      vStyles;
                 lltl::pphash<LSPString, lsp::Color> vColors;
+                lltl::parray<Style>                 vPending;       // Styles with pending notifications
+                lltl::darray<pending_t>            *pBatch;         // Batch of notifications being delivered
+                size_t                              nPass;          // Counter of notification passes
+                Style                              *pStyles;        // List of all styles bound to the schema
+                StringPool                          sStrings;       // Interned string values of properties
+                size_t                              nTransaction;   // Transaction nesting level
+                StyleSheet                         *pApplied;       // Copy of the last applied style sheet
 
                 prop::Float                         sScaling;
                 prop::Float                         sFontScaling;
@@ -109,11 +126,14 @@ namespace lsp
                 status_t            unlink_styles();
                 status_t            link_styles(const StyleSheet *sheet);
                 status_t            configure_styles(const StyleSheet *sheet);
-                static bool         check_parents_configured(Style *s);
 
                 status_t            apply_settings(Style *s, StyleSheet::style_t *xs);
+                status_t            apply_setting(Style *s, const LSPString *name, const LSPString *value);
                 status_t            apply_relations(Style *s, const lltl::parray<LSPString> *parents);
                 status_t            apply_relations(Style *s, const char *parents);
+                status_t            resolve_parents(lltl::parray<Style> *dst, const lltl::parray<LSPString> *parents);
+                status_t            resolve_parents(lltl::parray<Style> *dst, const char *parents);
+                Style              *resolve_parent(const LSPString *name);
                 void                destroy_colors();
                 status_t            init_colors_from_sheet(const StyleSheet *sheet);
                 status_t            load_fonts_from_sheet(const StyleSheet *sheet, resource::ILoader *loader);
@@ -121,7 +141,24 @@ namespace lsp
 
                 void                bind(Style *root);
 
+                void                link_style(Style *s);
+                void                unlink_style(Style *s);
+                void                detach_styles();
+                void                defer_notify(Style *s);
+                void                cancel_notify(Style *s);
+                void                deliver_pending();
+                size_t              style_depth(Style *s);
+                static ssize_t      cmp_pending(const pending_t *a, const pending_t *b);
+
                 status_t            apply_internal(const StyleSheet *sheet, resource::ILoader *loader);
+                status_t            apply_changes(const StyleSheet *sheet, resource::ILoader *loader);
+                status_t            update_colors(const StyleSheet *sheet, lltl::parray<LSPString> *changed);
+                status_t            update_relations(const StyleSheet *sheet);
+                status_t            update_settings(Style *s, const StyleSheet::style_t *xs, const StyleSheet::style_t *old);
+                void                renotify_colors(const lltl::parray<LSPString> *changed);
+                static bool         references_color(const char *value, const lltl::parray<LSPString> *names);
+                static bool         same_fonts(const StyleSheet *a, const StyleSheet *b);
+                static bool         same_parents(Style *s, const lltl::parray<Style> *parents);
 
             public:
                 explicit Schema(Atoms *atoms, Display *dpy);
@@ -173,7 +210,9 @@ namespace lsp
                 status_t            add(IStyleFactory *factory);
 
                 /**
-                 * Apply stylesheet settings to the schema
+                 * Apply stylesheet settings to the schema. If another style sheet has been
+                 * applied before, only fonts, colors, relations and properties that differ
+                 * from the previously applied style sheet are updated
                  * @param sheet style sheet
                  * @param loader resource loader
                  * @return status of operation
@@ -209,6 +248,12 @@ namespace lsp
                  */
                 inline Style       *root() { return pRoot;  }
 
+                /**
+                 * Get display the schema is associated with
+                 * @return display or NULL if schema is not associated with display
+                 */
+                inline Display     *display() const             { return pDisplay;  }
+
                 /**
                  * Get style by class identifier.
                  * If style does not exists, it will be automatically created and bound to the root style
@@ -267,6 +312,37 @@ namespace lsp
                  */
                 inline bool         config_mode() const           { return nFlags & S_CONFIGURING;  }
 
+                /**
+                 * Begin schema-wide transaction. Until the end of transaction, notifications
+                 * of property listeners of all styles are deferred. At the end of transaction,
+                 * each listener is notified at most once for each changed property, styles
+                 * are processed in the topological order: parent styles before children.
+                 * Transactions can be nested, notifications are delivered at the end of
+                 * the outermost transaction.
+                 *
+                 * @return status of operation
+                 */
+                status_t            begin();
+
+                /**
+                 * End schema-wide transaction and deliver pending notifications
+                 * @return status of operation
+                 */
+                status_t            end();
+
+                /**
+                 * Check that schema-wide transaction is active
+                 * @return true if schema-wide transaction is active
+                 */
+                inline bool         in_transaction() const        { return nTransaction > 0;        }
+
+                /**
+                 * Get memory usage statistics of all styles bound to the schema,
+                 * including styles of widgets
+                 * @param stats pointer to store statistics
+                 */
+                void                get_memory_stats(style_memory_stats_t *stats) const;
+
                 /**
                  * Load font and add to the repository
                  * @param name font name in UTF-8
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_TK_STYLE_STRINGPOOL_H_
+#define LSP_PLUG_IN_TK_STYLE_STRINGPOOL_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Pool of interned immutable strings used as values of style properties.
+         * Equal strings are stored once and shared by all styles of the schema,
+         * so interned strings can be compared by their pointers. The empty string
+         * is never allocated and is not reference-counted.
+         */
+        class StringPool
+        {
+            private:
+                StringPool & operator = (const StringPool &);
+                StringPool(const StringPool &);
+
+            protected:
+                typedef struct entry_t
+                {
+                    entry_t            *pNext;          // Next entry in the bin
+                    size_t              nHash;          // Hash of the string
+                    size_t              nRefs;          // Number of references
+                    size_t              nLength;        // Length of the string in bytes
+                } entry_t;
+
+            protected:
+                entry_t               **vBins;          // Hash bins
+                size_t                  nBins;          // Number of hash bins
+                size_t                  nItems;         // Number of unique strings
+                size_t                  nRefs;          // Overall number of references
+                size_t                  nBytes;         // Amount of memory allocated for strings
+
+            protected:
+                static size_t           hash(const char *s, size_t *len);
+                static inline char     *data(entry_t *e)            { return reinterpret_cast<char *>(&e[1]);   }
+                static inline entry_t  *entry(const char *s)        { return &reinterpret_cast<entry_t *>(const_cast<char *>(s))[-1]; }
+                bool                    grow();
+
+            public:
+                explicit StringPool();
+                ~StringPool();
+
+                /**
+                 * Release all strings stored in the pool
+                 */
+                void                    destroy();
+
+            public:
+                /**
+                 * Get the empty string
+                 * @return the empty string
+                 */
+                static const char      *empty();
+
+                /**
+                 * Intern the string: get the shared copy of the string and increment
+                 * the number of references
+                 * @param s string to intern
+                 * @return interned string or NULL if there is not enough memory
+                 */
+                const char             *intern(const char *s);
+
+                /**
+                 * Increment the number of references of the interned string
+                 * @param s interned string
+                 * @return the same interned string
+                 */
+                const char             *acquire(const char *s);
+
+                /**
+                 * Decrement the number of references of the interned string and
+                 * free it when there are no more references
+                 * @param s interned string, may be NULL
+                 */
+                void                    release(const char *s);
+
+                /**
+                 * Get number of unique strings stored in the pool
+                 * @return number of unique strings
+                 */
+                inline size_t           size() const                { return nItems;        }
+
+                /**
+                 * Get number of references to strings stored in the pool
+                 * @return number of references
+                 */
+                inline size_t           references() const          { return nRefs;         }
+
+                /**
+                 * Get amount of memory used by the pool
+                 * @return amount of memory in bytes
+                 */
+                inline size_t           bytes() const               { return nBytes + nBins * sizeof(entry_t *); }
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_STYLE_STRINGPOOL_H_ */
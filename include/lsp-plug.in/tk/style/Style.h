@@ -53,6 +53,7 @@ namespace lsp
                     F_OVERRIDDEN        = 1 << 0,   // Property has been locally overridden by client
                     F_NTF_LISTENERS     = 1 << 1,   // Property requires notification of listeners
                     F_NTF_CHILDREN      = 1 << 2,   // Property requires notification of children
+                    F_DEFAULT           = 1 << 3,   // Property has non-empty local default value
                 };
 
                 enum style_flags_t
@@ -60,34 +61,34 @@ namespace lsp
                     S_DELAYED           = 1 << 0,   // Delayed notification
                     S_OVERRIDE          = 1 << 1,   // Force overrides
                     S_CONFIGURED        = 1 << 2,   // The changes to style have been configured
+                    S_PENDING           = 1 << 3,   // Style has pending notifications in the schema transaction
                 };
 
+                typedef union value_t
+                {
+                    ssize_t             iValue;
+                    float               fValue;
+                    bool                bValue;
+                    const char         *sValue;     // Interned string
+                } value_t;
+
                 typedef struct property_t
                 {
-                    atom_t              id;         // Unique identifier of property
-                    property_type_t     type;       // Type of property
-                    ssize_t             refs;       // Number of references
-                    size_t              changes;    // Number of changes
-                    size_t              flags;      // Flags
                     Style              *owner;      // Style that is owning a property
-
-                    union
-                    {
-                        ssize_t             iValue;
-                        float               fValue;
-                        bool                bValue;
-                        char               *sValue;
-                    } v;                            // Actual property value
-
-                    union
-                    {
-                        ssize_t             iValue;
-                        float               fValue;
-                        bool                bValue;
-                        char               *sValue;
-                    } dv;                           // Property local default value
+                    value_t             v;          // Actual property value
+                    int32_t             id;         // Unique identifier of property
+                    int32_t             refs;       // Number of references
+                    uint32_t            changes;    // Number of changes
+                    uint8_t             type;       // Type of property
+                    uint8_t             flags;      // Flags
                 } property_t;
 
+                typedef struct default_t
+                {
+                    atom_t              id;         // Property identifier
+                    value_t             v;          // Property local default value
+                } default_t;
+
                 typedef struct listener_t
                 {
                     atom_t              nId;        // Property identifier
@@ -107,16 +108,42 @@ namespace lsp
                     Property           *pClient;
                 } client_t;
 
+                typedef struct snapshot_item_t
+                {
+                    atom_t              nId;        // Property identifier
+                    uint8_t             nType;      // Type of property
+                    uint8_t             nFlags;     // Flags of the property
+                    value_t             v;          // Value of the property
+                    value_t             dv;         // Default value of the property
+                } snapshot_item_t;
+
+                typedef struct snapshot_t
+                {
+                    size_t              nRefs;      // Number of references
+                    size_t              nVersion;   // Version of the style the snapshot has been taken from
+                    StringPool         *pStrings;   // String pool which holds the string values
+                    lltl::darray<snapshot_item_t>   vItems;     // Items sorted by property identifier
+                    size_t              nListeners; // Number of listener bindings of the source style
+                } snapshot_t;
+
             private:
                 lltl::parray<Style>             vParents;
                 lltl::parray<Style>             vChildren;
                 lltl::darray<property_t>        vProperties;
+                lltl::darray<default_t>         vDefaults;
                 lltl::darray<listener_t>        vListeners;
                 lltl::parray<IStyleListener>    vLocks;
                 mutable Schema                 *pSchema;
                 size_t                          nFlags;
                 char                           *sName;
                 char                           *sDflParents;
+                Style                          *pPrevLink;      // Previous style in the list of schema styles
+                Style                          *pNextLink;      // Next style in the list of schema styles
+                size_t                          nVersion;       // Version of the property table
+                snapshot_t                     *pSnapshot;      // Snapshot of this style shared with clones
+                snapshot_t                     *pPrototype;     // Snapshot of the prototype used for binding
+                size_t                          nDepth;         // Depth in the inheritance graph computed by the schema
+                size_t                          nDepthPass;     // Notification pass the depth has been computed at
 
             public:
                 explicit Style(Schema *schema, const char *name, const char *parents);
@@ -132,6 +159,19 @@ namespace lsp
 
             protected:
                 void                undef_property(property_t *property);
+                StringPool         *strings();
+                const char         *acquire_string(const char *s);
+                void                release_string(const char *s);
+                void                detach_schema();
+                static void         empty_value(value_t *v, size_t type);
+                static bool         same_value(const value_t *a, const value_t *b, size_t type);
+                static void         get_default_value(value_t *dst, const property_t *p);
+                default_t          *get_default(atom_t id);
+                status_t            set_default_value(property_t *p, const value_t *dv);
+                void                drop_default_value(property_t *p);
+                void                set_value(property_t *p, const value_t *v);
+                property_t         *add_property(atom_t id, size_t type, const value_t *v, const value_t *dv, size_t flags);
+                void                get_memory_stats(style_memory_stats_t *stats) const;
                 void                do_destroy();
                 void                delayed_notify();
                 property_t         *get_property_recursive(atom_t id);
@@ -144,6 +184,9 @@ namespace lsp
                 status_t            set_property_default(property_t *dst);
                 status_t            copy_property(property_t *dst, const property_t *src);
                 status_t            update_default_value(property_t *p, const property_t *src);
+                snapshot_t         *get_snapshot();
+                static void         release_snapshot(snapshot_t *snapshot);
+                static const snapshot_item_t *find_snapshot_item(const snapshot_t *snapshot, atom_t id);
 
                 inline const property_t   *get_property(atom_t id) const { return const_cast<Style *>(this)->get_property(id); };
                 inline const property_t   *get_property_recursive(atom_t id) const { return const_cast<Style *>(this)->get_property_recursive(id); };
@@ -293,6 +336,18 @@ namespace lsp
                 status_t                set_default_parents(const char *parents);
                 status_t                set_default_parents(const LSPString *parents);
 
+                /**
+                 * Set prototype style: properties bound to this style are created with values,
+                 * default values and override flags of the prototype instead of empty values,
+                 * so they do not change when the style gets the same parents as the prototype.
+                 * The snapshot of the prototype is taken once and shared between all styles
+                 * that use the same unchanged prototype.
+                 *
+                 * @param proto prototype style, NULL to reset the prototype
+                 * @return status of operation
+                 */
+                status_t                set_prototype(Style *proto);
+
             public:
                 /**
                  * Bind listener to property
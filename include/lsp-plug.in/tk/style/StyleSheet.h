@@ -57,6 +57,8 @@ namespace lsp
                     LSPString                               name;       // Name of style
                     lltl::parray<LSPString>                 parents;    // List of parents
                     lltl::pphash<LSPString, LSPString>      properties; // properties
+                    lltl::parray<style_t>                   children;   // List of children, used for validation
+                    size_t                                  waiting;    // Number of not yet ordered parents, used for validation
 
                     style_t();
                     ~style_t();
@@ -69,16 +71,11 @@ namespace lsp
                     bool                                    alias;      // Is an alias
                 } font_t;
 
-                typedef struct path_t
-                {
-                    lltl::parray<style_t>                   visited;
-                    style_t                                *curr;
-                } path_t;
-
             protected:
                 LSPString                           sTitle;     // Schema title
                 style_t                            *pRoot;      // Root style
                 lltl::pphash<LSPString, style_t>    vStyles;    // Additional named styles
+                lltl::parray<style_t>               vOrder;     // Styles in topological order: parents before children
                 lltl::pphash<LSPString, font_t>     vFonts;     // Additional fonts
                 lltl::pphash<LSPString, lsp::Color> vColors;    // Color map
                 lltl::pphash<LSPString, LSPString>  vConstants; // Global constants
@@ -89,6 +86,9 @@ namespace lsp
                 ~StyleSheet();
 
             protected:
+                void                do_destroy();
+                static style_t     *copy_style(const style_t *src);
+
                 status_t            parse_document(xml::PullParser *p);
                 status_t            parse_schema(xml::PullParser *p);
                 status_t            parse_colors(xml::PullParser *p);
@@ -109,8 +109,7 @@ namespace lsp
                 status_t            add_parent(style_t *style, const LSPString *text);
 
                 status_t            validate();
-                status_t            validate_style(style_t *s);
-                static void         drop_paths(lltl::parray<path_t> *paths);
+                status_t            order_styles(lltl::parray<style_t> *vs);
 
             public:
                 status_t            parse_file(const char *path, const char *charset = NULL);
@@ -122,6 +121,13 @@ namespace lsp
                 status_t            parse_data(const LSPString *str);
                 status_t            parse_data(io::IInSequence *seq, size_t flags = WRAP_NONE);
 
+                /**
+                 * Make a deep copy of another style sheet, the previous contents is dropped
+                 * @param src style sheet to copy
+                 * @return status of operation
+                 */
+                status_t            copy(const StyleSheet *src);
+
             public:
                 inline const LSPString *title() const                               { return &sTitle;       }
                 status_t            enum_colors(lltl::parray<LSPString> *names) const;
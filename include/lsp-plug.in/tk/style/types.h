@@ -32,6 +32,22 @@ namespace lsp
     {
         class Style;
         class Schema;
+        class StringPool;
+
+        /**
+         * Memory usage statistics of styles
+         */
+        typedef struct style_memory_stats_t
+        {
+            size_t              nStyles;        // Number of styles
+            size_t              nProperties;    // Number of properties stored by styles
+            size_t              nDefaults;      // Number of non-empty local default values
+            size_t              nListeners;     // Number of listener bindings
+            size_t              nStrings;       // Number of unique interned strings
+            size_t              nStringRefs;    // Number of references to interned strings
+            size_t              nStyleBytes;    // Estimated amount of memory used by styles
+            size_t              nStringBytes;   // Amount of memory used by interned strings
+        } style_memory_stats_t;
 
         /**
          * Style initialization function
@@ -66,17 +66,25 @@ namespace lsp
 
                 SlotSet                 sSlots;
                 Schema                  sSchema;
+                SurfacePool             sSurfacePool;
+                StringCache             sStringCache;
+                FrameScheduler          sFrameScheduler;
+                WindowPool              sWindowPool;
+                TimerWheel              sTimerWheel;
 
                 i18n::IDictionary      *pDictionary;
                 ws::IDisplay           *pDisplay;
 
                 resource::ILoader      *pResourceLoader;
                 resource::Environment  *pEnv;
+                bool                    bHeadless;
 
             protected:
                 void                do_destroy();
                 void                garbage_collect();
                 status_t            init_schema();
+                status_t            init_headless(int argc, const char **argv);
+                status_t            load_dictionary();
 
             protected:
                 static status_t     main_task_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg);
@@ -231,6 +239,42 @@ namespace lsp
                  */
                 inline SlotSet *slots()                     { return &sSlots; }
 
+                /**
+                 * Get pool of widget drawing surfaces
+                 * @return pool of widget drawing surfaces
+                 */
+                inline SurfacePool *surface_pool()          { return &sSurfacePool; }
+
+                /**
+                 * Get cache of localized string templates
+                 * @return cache of localized string templates
+                 */
+                inline StringCache *string_cache()          { return &sStringCache; }
+
+                /**
+                 * Get frame scheduler which renders all visible windows of the display
+                 * @return frame scheduler
+                 */
+                inline FrameScheduler *frame_scheduler()    { return &sFrameScheduler; }
+
+                /**
+                 * Get pool of hidden native windows used by popup windows
+                 * @return pool of native windows
+                 */
+                inline WindowPool *window_pool()            { return &sWindowPool; }
+
+                /**
+                 * Get timer wheel which schedules all timers bound to the display
+                 * @return timer wheel
+                 */
+                inline TimerWheel *timer_wheel()            { return &sTimerWheel; }
+
+                /**
+                 * Get memory usage statistics of all styles of the display
+                 * @param stats pointer to store statistics
+                 */
+                inline void get_style_memory_stats(style_memory_stats_t *stats) const   { sSchema.get_memory_stats(stats); }
+
                 /** Get slot
                  *
                  * @param id slot identifier
@@ -244,6 +288,12 @@ namespace lsp
                  */
                 inline ws::IDisplay *display()              { return pDisplay; }
 
+                /** Check that display is headless and does not use the window system
+                 *
+                 * @return true if display is headless
+                 */
+                inline bool is_headless() const             { return bHeadless; }
+
                 /**
                  * Obtain number of screens
                  * @return number of screens
@@ -256,6 +306,12 @@ namespace lsp
                  */
                 inline i18n::IDictionary *dictionary()      { return pDictionary;               }
 
+                /**
+                 * Reload the dictionary from resources and drop all cached localization templates
+                 * @return status of operation
+                 */
+                status_t                reload_dictionary();
+
                 /**
                  * Get environment
                  * @return environment
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_TK_SYS_DISPLAYLIST_H_
+#define LSP_PLUG_IN_TK_SYS_DISPLAYLIST_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ws/ISurface.h>
+#include <lsp-plug.in/lltl/darray.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Retained list of drawing commands of graph items. The item records drawing primitives
+         * to the list instead of issuing them to the surface and then replays the list
+         * to the surface. While the state of the item does not change, the list can
+         * be replayed again without re-computing the geometry and colors of primitives.
+         * Only the primitives used by graph items are supported, the list is not a general
+         * purpose recording surface.
+         */
+        class DisplayList
+        {
+            private:
+                DisplayList & operator = (const DisplayList &);
+                DisplayList(const DisplayList &);
+
+            protected:
+                enum command_type_t
+                {
+                    CMD_ANTIALIASING,       // Set anti-aliasing
+                    CMD_LINE,               // Draw line
+                    CMD_PARAMETRIC_LINE,    // Draw parametric line
+                    CMD_PARAMETRIC_BAR,     // Draw parametric bar
+                    CMD_FILL_CIRCLE,        // Fill circle
+                    CMD_FILL_POLY           // Fill polygon
+                };
+
+                enum gradient_type_t
+                {
+                    GR_NONE,                // Solid color
+                    GR_LINEAR,              // Linear gradient
+                    GR_RADIAL               // Radial gradient
+                };
+
+                typedef struct stop_t
+                {
+                    float               fOffset;        // Offset of the color stop
+                    float               fAlpha;         // Alpha value
+                    lsp::Color          sColor;         // Color
+                } stop_t;
+
+                typedef struct gradient_t
+                {
+                    size_t              nType;          // Type of gradient
+                    float               vArgs[5];       // Arguments of gradient
+                    size_t              nFirst;         // Index of the first color stop
+                    size_t              nStops;         // Number of color stops
+                } gradient_t;
+
+                typedef struct command_t
+                {
+                    size_t              nType;          // Type of command
+                    ssize_t             nGradient;      // Index of gradient, negative if solid color is used
+                    float               vArgs[10];      // Arguments of command
+                    size_t              nFirst;         // Index of first point
+                    size_t              nPoints;        // Number of points
+                    bool                bFlag;          // Flag argument
+                    lsp::Color          sColor;         // Color of the primitive
+                } command_t;
+
+            protected:
+                lltl::darray<command_t>     vCommands;      // List of commands
+                lltl::darray<gradient_t>    vGradients;     // List of gradients
+                lltl::darray<stop_t>        vStops;         // List of gradient color stops
+                lltl::darray<float>         vPoints;        // Coordinates of polygon points
+
+            protected:
+                command_t              *add_command(size_t type, ssize_t gradient);
+                ssize_t                 add_gradient(size_t type, float a0, float a1, float a2, float a3, float a4);
+                ws::IGradient          *create_gradient(ws::ISurface *s, ssize_t index) const;
+
+            public:
+                explicit DisplayList();
+                ~DisplayList();
+
+                /**
+                 * Drop all recorded commands and free allocated memory
+                 */
+                void                    destroy();
+
+            public:
+                /**
+                 * Drop all recorded commands but keep allocated memory for further recording
+                 */
+                void                    clear();
+
+                /**
+                 * Check that display list is empty
+                 * @return true if display list is empty
+                 */
+                inline bool             is_empty() const        { return vCommands.is_empty();      }
+
+                /**
+                 * Get number of recorded commands
+                 * @return number of recorded commands
+                 */
+                inline size_t           size() const            { return vCommands.size();          }
+
+                /**
+                 * Replay all recorded commands to the surface. The anti-aliasing mode of the
+                 * surface is restored after the replay.
+                 * @param s surface to draw
+                 */
+                void                    replay(ws::ISurface *s) const;
+
+            public:
+                /**
+                 * Create linear gradient
+                 * @return gradient identifier or negative value on error
+                 */
+                ssize_t                 linear_gradient(float x0, float y0, float x1, float y1);
+
+                /**
+                 * Create radial gradient
+                 * @return gradient identifier or negative value on error
+                 */
+                ssize_t                 radial_gradient(float cx0, float cy0, float cx1, float cy1, float r);
+
+                /**
+                 * Add color stop to the gradient
+                 * @param gradient gradient identifier
+                 * @param offset offset of the color stop
+                 * @param c color
+                 */
+                void                    add_color(ssize_t gradient, float offset, const lsp::Color &c);
+                void                    add_color(ssize_t gradient, float offset, const lsp::Color &c, float a);
+
+                void                    set_antialiasing(bool set);
+
+                void                    line(const lsp::Color &c, float x0, float y0, float x1, float y1, float width);
+
+                void                    parametric_line(const lsp::Color &color, float a, float b, float c,
+                                            ssize_t left, ssize_t right, ssize_t bottom, ssize_t top, float width);
+
+                void                    parametric_bar(ssize_t gradient,
+                                            float a1, float b1, float c1, float a2, float b2, float c2,
+                                            ssize_t left, ssize_t right, ssize_t bottom, ssize_t top);
+
+                void                    fill_circle(const lsp::Color &c, float x, float y, float r);
+                void                    fill_circle(ssize_t gradient, float x, float y, float r);
+
+                void                    fill_poly(ssize_t gradient, const float *x, const float *y, size_t n);
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_DISPLAYLIST_H_ */
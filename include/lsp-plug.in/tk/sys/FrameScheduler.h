@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_TK_SYS_FRAMESCHEDULER_H_
+#define LSP_PLUG_IN_TK_SYS_FRAMESCHEDULER_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ws/IDisplay.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+// The default maximum frame rate
+#define LSP_TK_FRAME_RATE_DEFAULT       25.0f
+// The minimum frame rate the scheduler can fall back to under overload
+#define LSP_TK_FRAME_RATE_MIN           5.0f
+
+namespace lsp
+{
+    namespace tk
+    {
+        class Display;
+        class Window;
+
+        /**
+         * Frame scheduler statistics
+         */
+        typedef struct frame_stats_t
+        {
+            float               fTargetFPS;     // Current target frame rate
+            float               fAchievedFPS;   // Frame rate achieved during the last measurement period
+            float               fRenderTime;    // Average time spent to render a frame, milliseconds
+            size_t              nWindows;       // Number of windows served by the scheduler
+            size_t              nRequests;      // Overall number of redraw requests
+            size_t              nFrames;        // Overall number of rendered frames
+            size_t              nSkipped;       // Overall number of frames skipped due to overload
+            size_t              nIdle;          // Overall number of transitions to the idle state
+            bool                bIdle;          // Scheduler is idle and does not tick
+        } frame_stats_t;
+
+        /**
+         * Frame scheduler of the display. Redraw requests issued by all visible windows
+         * are coalesced into a single frame tick which renders all windows that have
+         * pending changes. The scheduler does not tick at all while there is nothing
+         * to render and no widget requested animation. The interval between frames is
+         * adapted to the average render time, and the frame is skipped when the tick
+         * arrives too late to give the event loop a chance to process input.
+         */
+        class FrameScheduler
+        {
+            private:
+                FrameScheduler & operator = (const FrameScheduler &);
+                FrameScheduler(const FrameScheduler &);
+
+            protected:
+                Display                *pDisplay;       // Display
+                lltl::parray<Window>    vWindows;       // Visible windows
+                ws::taskid_t            nTaskID;        // Identifier of the scheduled tick, negative if idle
+                ws::timestamp_t         nLastFrame;     // Time of the last rendered frame
+                size_t                  nMinInterval;   // Minimum interval between frames, milliseconds
+                size_t                  nMaxInterval;   // Maximum interval between frames, milliseconds
+                size_t                  nInterval;      // Current interval between frames, milliseconds
+                float                   fRenderTime;    // Average render time, milliseconds
+                bool                    bAnimation;     // Animation has been requested for the next frame
+                bool                    bSkipped;       // The previous tick has been skipped
+                bool                    bTicking;       // Windows are being rendered
+
+                ws::timestamp_t         nFpsStart;      // Start of the frame rate measurement period
+                size_t                  nFpsFrames;     // Number of frames rendered during the measurement period
+                float                   fAchievedFPS;   // Achieved frame rate
+                size_t                  nRequests;      // Number of redraw requests
+                size_t                  nFrames;        // Number of rendered frames
+                size_t                  nSkippedFrames; // Number of skipped frames
+                size_t                  nIdle;          // Number of transitions to the idle state
+
+            protected:
+                static status_t         tick_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg);
+
+                status_t                tick(ws::timestamp_t sched, ws::timestamp_t time);
+                void                    schedule(ws::timestamp_t time);
+                void                    adapt_interval(ws::timestamp_t render_time);
+                void                    update_fps(ws::timestamp_t time);
+                bool                    frame_pending() const;
+
+            public:
+                explicit FrameScheduler(Display *dpy);
+                ~FrameScheduler();
+
+                /**
+                 * Cancel the scheduled tick and forget all windows
+                 */
+                void                    destroy();
+
+            public:
+                /**
+                 * Add the window to the list of windows rendered by the scheduler,
+                 * should be called when the window becomes visible
+                 * @param wnd window to add
+                 * @return status of operation
+                 */
+                status_t                add(Window *wnd);
+
+                /**
+                 * Remove the window from the list of windows rendered by the scheduler
+                 * @param wnd window to remove
+                 */
+                void                    remove(Window *wnd);
+
+                /**
+                 * Request the next frame. Multiple requests issued before the tick are
+                 * coalesced into one frame.
+                 */
+                void                    request_frame();
+
+                /**
+                 * Request animation: the scheduler keeps the target frame rate for the
+                 * next frame even if there are no pending changes. Animated widgets
+                 * should issue the request each frame while the animation lasts.
+                 */
+                void                    request_animation();
+
+                /**
+                 * Check whether scheduler is idle
+                 * @return true if scheduler is idle
+                 */
+                inline bool             idle() const                { return nTaskID < 0;   }
+
+                /**
+                 * Get the maximum frame rate
+                 * @return maximum frame rate
+                 */
+                float                   frame_rate() const;
+
+                /**
+                 * Set the maximum frame rate
+                 * @param fps maximum frame rate
+                 */
+                void                    set_frame_rate(float fps);
+
+                /**
+                 * Get statistics of the scheduler
+                 * @param stats pointer to store statistics
+                 */
+                void                    get_stats(frame_stats_t *stats);
+
+                /**
+                 * Reset counters of the statistics
+                 */
+                void                    reset_stats();
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_FRAMESCHEDULER_H_ */
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_TK_SYS_STRINGCACHE_H_
+#define LSP_PLUG_IN_TK_SYS_STRINGCACHE_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/i18n/IDictionary.h>
+#include <lsp-plug.in/lltl/pphash.h>
+#include <lsp-plug.in/runtime/LSPString.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * String cache statistics
+         */
+        typedef struct string_cache_stats_t
+        {
+            size_t              nEntries;       // Number of cached templates
+            size_t              nHits;          // Overall number of lookups satisfied by the cache
+            size_t              nMisses;        // Overall number of lookups that required dictionary access
+            size_t              nFlushes;       // Overall number of cache invalidations
+        } string_cache_stats_t;
+
+        /**
+         * Cache of localized message templates shared by all localized strings of the display.
+         * The template is resolved once for each (language, key) pair, including the fallback
+         * to the default language, so the further formatting of the string does not require
+         * access to the dictionary. Templates that do not contain any formatting directives
+         * are marked as plain and can be used as the result without formatting.
+         */
+        class StringCache
+        {
+            private:
+                StringCache & operator = (const StringCache &);
+                StringCache(const StringCache &);
+
+            public:
+                typedef struct template_t
+                {
+                    LSPString           sText;          // Resolved template
+                    bool                bFound;         // Template has been found in the dictionary
+                    bool                bPlain;         // Template does not contain formatting directives
+                } template_t;
+
+            protected:
+                lltl::pphash<LSPString, template_t> vTemplates;     // Resolved templates indexed by "lang.key"
+                i18n::IDictionary                  *pDict;          // Dictionary the templates were resolved from
+                size_t                              nHits;          // Number of cache hits
+                size_t                              nMisses;        // Number of cache misses
+                size_t                              nFlushes;       // Number of invalidations
+
+            protected:
+                static bool             is_plain(const LSPString *text);
+                static status_t         lookup_path(i18n::IDictionary *dict, LSPString *path, LSPString *dst,
+                                            const char *lang, const LSPString *key);
+                template_t             *resolve(i18n::IDictionary *dict, LSPString *path, const LSPString *lang, const LSPString *key);
+
+            public:
+                explicit StringCache();
+                ~StringCache();
+
+                /**
+                 * Drop all cached templates
+                 */
+                void                    destroy();
+
+            public:
+                /**
+                 * Get resolved template for the localized string. The returned pointer remains
+                 * valid until the next call of get() or invalidate().
+                 *
+                 * @param dict dictionary to lookup the template, the cache is invalidated when
+                 *   the dictionary differs from the dictionary used before
+                 * @param lang language, NULL or empty for default language
+                 * @param key localization key
+                 * @return pointer to the resolved template or NULL on error
+                 */
+                const template_t       *get(i18n::IDictionary *dict, const LSPString *lang, const LSPString *key);
+
+                /**
+                 * Invalidate all cached templates, should be called when the contents
+                 * of the dictionary has changed
+                 */
+                void                    invalidate();
+
+                /**
+                 * Get statistics of the cache
+                 * @param stats pointer to store statistics
+                 */
+                void                    get_stats(string_cache_stats_t *stats) const;
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_STRINGCACHE_H_ */
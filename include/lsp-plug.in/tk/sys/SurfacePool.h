@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_TK_SYS_SURFACEPOOL_H_
+#define LSP_PLUG_IN_TK_SYS_SURFACEPOOL_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ws/ISurface.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+// The default memory budget for all surfaces held by the pool, in bytes
+#define LSP_TK_SURFACE_POOL_BUDGET      (size_t(128) << 20)
+
+namespace lsp
+{
+    namespace tk
+    {
+        class Widget;
+
+        /**
+         * Surface pool statistics
+         */
+        typedef struct surface_pool_stats_t
+        {
+            size_t              nBudget;        // Memory budget in bytes, 0 if unlimited
+            size_t              nUsed;          // Number of surfaces owned by widgets except windows
+            size_t              nUsedBytes;     // Amount of memory held by surfaces owned by widgets except windows
+            size_t              nFree;          // Number of surfaces available for reuse
+            size_t              nFreeBytes;     // Amount of memory held by surfaces available for reuse
+            size_t              nWindow;        // Number of back buffers owned by windows
+            size_t              nWindowBytes;   // Amount of memory held by back buffers of windows
+            size_t              nAllocated;     // Overall number of surface allocations
+            size_t              nReused;        // Overall number of requests satisfied by recycled surfaces
+            size_t              nEvicted;       // Overall number of surfaces evicted due to memory budget
+        } surface_pool_stats_t;
+
+        /**
+         * Pool of widget drawing surfaces. Surfaces released by widgets are kept for
+         * the further reuse and are looked up by their size class. The overall amount
+         * of memory held by surfaces is limited by the memory budget: when it is exceeded,
+         * the pool drops released surfaces first and then evicts surfaces of hidden and
+         * least recently drawn widgets. Back buffers of windows are accounted separately:
+         * they do not count toward the budget and are never evicted.
+         */
+        class SurfacePool
+        {
+            private:
+                SurfacePool & operator = (const SurfacePool &);
+                SurfacePool(const SurfacePool &);
+
+            protected:
+                typedef struct entry_t
+                {
+                    ws::ISurface       *pSurface;       // The surface
+                    Widget             *pOwner;         // Owner of the surface, NULL if surface is free
+                    size_t              nBytes;         // Estimated amount of memory held by surface
+                    bool                bWindow;        // Surface is the back buffer of the window
+                } entry_t;
+
+            protected:
+                lltl::parray<entry_t>   vUsed;          // Surfaces owned by widgets
+                lltl::parray<entry_t>   vFree;          // Surfaces available for reuse, the last is most recent
+                size_t                  nBudget;        // Memory budget
+                size_t                  nUsedBytes;     // Memory held by owned surfaces
+                size_t                  nFreeBytes;     // Memory held by free surfaces
+                size_t                  nWindow;        // Number of window back buffers
+                size_t                  nWindowBytes;   // Memory held by window back buffers
+                size_t                  nFrame;         // Current frame counter
+                size_t                  nAllocated;     // Number of allocations
+                size_t                  nReused;        // Number of reused surfaces
+                size_t                  nEvicted;       // Number of evicted surfaces
+
+            protected:
+                static void             destroy_entry(entry_t *e);
+                static ssize_t          cmp_eviction(const entry_t *a, const entry_t *b);
+                static bool             is_hidden(const Widget *w);
+                static bool             is_window(Widget *w);
+                static bool             matches(const ws::ISurface *s, size_t width, size_t height);
+
+                ssize_t                 index_of_used(const ws::ISurface *s) const;
+                void                    enforce_budget(const entry_t *keep);
+                void                    evict(entry_t *e);
+                void                    drop_free(size_t count);
+                void                    add_used(entry_t *e, Widget *owner);
+                void                    remove_used(entry_t *e);
+
+            public:
+                explicit SurfacePool();
+                ~SurfacePool();
+
+                /**
+                 * Destroy all surfaces held by the pool and detach surfaces from owners
+                 */
+                void                    destroy();
+
+            public:
+                /**
+                 * Compute the size class for the surface dimension
+                 * @param value surface dimension in pixels
+                 * @return dimension of surface that will be allocated
+                 */
+                static size_t           size_class(size_t value);
+
+                /**
+                 * Check that surface can be used for drawing area of the specified size
+                 * @param s surface to check
+                 * @param width requested width
+                 * @param height requested height
+                 * @param exact the surface should exactly match the requested size
+                 * @return true if surface can be used
+                 */
+                static bool             fits(const ws::ISurface *s, ssize_t width, ssize_t height, bool exact);
+
+                /**
+                 * Acquire surface for the widget
+                 * @param owner the widget that will own the surface
+                 * @param factory the surface used to create compatible surfaces
+                 * @param width requested width
+                 * @param height requested height
+                 * @param exact allocate surface of exact size instead of the size class
+                 * @return surface or NULL on error
+                 */
+                ws::ISurface           *acquire(Widget *owner, ws::ISurface *factory, ssize_t width, ssize_t height, bool exact);
+
+                /**
+                 * Return the surface to the pool
+                 * @param s surface to return
+                 */
+                void                    release(ws::ISurface *s);
+
+                /**
+                 * Mark the beginning of the new frame, widgets that did not access their
+                 * surfaces for a long time become candidates for eviction
+                 */
+                inline void             next_frame()                { ++nFrame;             }
+
+                /**
+                 * Get current frame number
+                 * @return current frame number
+                 */
+                inline size_t           frame() const               { return nFrame;        }
+
+                /**
+                 * Drop all surfaces that are available for reuse
+                 */
+                void                    flush();
+
+                /**
+                 * Get memory budget
+                 * @return memory budget in bytes, zero means unlimited
+                 */
+                inline size_t           budget() const              { return nBudget;       }
+
+                /**
+                 * Set memory budget
+                 * @param bytes memory budget in bytes, zero means unlimited
+                 */
+                void                    set_budget(size_t bytes);
+
+                /**
+                 * Drop surfaces available for reuse and evict surfaces of hidden and least
+                 * recently drawn widgets until the memory budget is satisfied
+                 */
+                void                    trim();
+
+                /**
+                 * Get statistics of the pool
+                 * @param stats pointer to store statistics
+                 */
+                void                    get_stats(surface_pool_stats_t *stats) const;
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_SURFACEPOOL_H_ */
@@ -33,12 +33,16 @@ namespace lsp
     namespace tk
     {
         class Display;
+        class TimerWheel;
 
         /** Simple timer interface to launch scheduled or periodic tasks
          *
          */
         class Timer
         {
+            private:
+                friend class TimerWheel;
+
             protected:
                 enum flags_t
                 {
@@ -61,6 +65,12 @@ namespace lsp
                 status_t            nErrorCode;
                 ws::taskid_t        nTaskID;
 
+                TimerWheel         *pWheel;         // Timer wheel of the display, NULL if not bound to the wheel
+                Timer              *pWheelPrev;     // Previous timer in the slot of the wheel
+                Timer              *pWheelNext;     // Next timer in the slot of the wheel
+                ws::timestamp_t     nDeadline;      // Deadline tick in the wheel
+                ssize_t             nWheelSlot;     // Slot of the wheel, negative if not scheduled
+
             protected:
                 static  status_t    execute(ws::timestamp_t sched, ws::timestamp_t time, void *arg);
                 status_t            execute_task(ws::timestamp_t sched, ws::timestamp_t time, void *arg);
@@ -85,7 +95,8 @@ namespace lsp
                  */
                 void    bind(ws::IDisplay *dpy);
 
-                /** Bind timer to the display
+                /** Bind timer to the display, the timer is scheduled by
+                 * the timer wheel of the display
                  *
                  * @param dpy LSP display
                  */
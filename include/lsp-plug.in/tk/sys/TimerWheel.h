@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_TK_SYS_TIMERWHEEL_H_
+#define LSP_PLUG_IN_TK_SYS_TIMERWHEEL_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ws/IDisplay.h>
+
+// The resolution of the timer wheel in milliseconds: deadlines are rounded up
+// to the resolution, so timers expiring within the same tick share one wakeup
+#define LSP_TK_TIMER_WHEEL_RESOLUTION   4
+
+namespace lsp
+{
+    namespace tk
+    {
+        class Display;
+        class Timer;
+
+        /**
+         * Timer wheel statistics
+         */
+        typedef struct timer_wheel_stats_t
+        {
+            size_t              nActive;        // Number of active timers
+            size_t              nWakeups;       // Overall number of wakeups of the wheel
+            size_t              nExpired;       // Overall number of timer expirations
+            float               fWakeupRate;    // Number of wakeups per second during the last measurement period
+        } timer_wheel_stats_t;
+
+        /**
+         * Hierarchical timer wheel of the display. All timers bound to the display
+         * are kept in the wheel which submits only one task to the native display
+         * for the earliest deadline. Near deadlines are stored in the first level of
+         * the wheel with the resolution of one tick, far deadlines are stored in the
+         * coarse upper levels and cascade down when the wheel turns.
+         */
+        class TimerWheel
+        {
+            private:
+                TimerWheel & operator = (const TimerWheel &);
+                TimerWheel(const TimerWheel &);
+
+                friend class Timer;
+
+            protected:
+                enum wheel_t
+                {
+                    L0_BITS         = 8,
+                    LN_BITS         = 6,
+                    L0_SIZE         = 1 << L0_BITS,
+                    LN_SIZE         = 1 << LN_BITS,
+                    LEVELS          = 3,
+                    OVERFLOW        = L0_SIZE + LN_SIZE * (LEVELS - 1),
+                    SLOTS           = OVERFLOW + 1
+                };
+
+                typedef struct slot_t
+                {
+                    Timer              *pHead;          // First timer in the slot
+                    Timer              *pTail;          // Last timer in the slot
+                } slot_t;
+
+            protected:
+                Display                *pDisplay;       // Display
+                slot_t                  vSlots[SLOTS];  // Slots of all levels and the overflow list
+                size_t                  vCount[LEVELS + 1]; // Number of timers per level
+                ws::timestamp_t         nCurrent;       // The next tick to process
+                ws::timestamp_t         nWakeup;        // Tick of the scheduled wakeup
+                ws::taskid_t            nTaskID;        // Identifier of the scheduled wakeup, negative if none
+                size_t                  nActive;        // Number of active timers
+                bool                    bProcessing;    // The wheel is processing expired timers
+
+                ws::timestamp_t         nRateStart;     // Start of the wakeup rate measurement period
+                size_t                  nRateWakeups;   // Number of wakeups during the measurement period
+                float                   fWakeupRate;    // Wakeup rate
+                size_t                  nWakeups;       // Number of wakeups
+                size_t                  nExpired;       // Number of expirations
+
+            protected:
+                static status_t         wakeup_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg);
+                static inline ws::timestamp_t to_tick(ws::timestamp_t time);
+                static inline ws::timestamp_t to_time(ws::timestamp_t tick);
+                static size_t           slot_level(size_t slot);
+
+                status_t                wakeup(ws::timestamp_t sched, ws::timestamp_t time);
+                void                    link(Timer *t);
+                void                    unlink(Timer *t);
+                void                    cascade(size_t first, size_t count);
+                void                    expire(ws::timestamp_t tick, ws::timestamp_t time);
+                void                    advance(ws::timestamp_t tick, ws::timestamp_t time);
+                ws::timestamp_t         earliest() const;
+                void                    update_wakeup();
+                void                    update_rate(ws::timestamp_t time);
+
+                status_t                schedule(Timer *t, ws::timestamp_t time);
+                void                    cancel(Timer *t);
+
+            public:
+                explicit TimerWheel(Display *dpy);
+                ~TimerWheel();
+
+                /**
+                 * Cancel the scheduled wakeup and detach all timers
+                 */
+                void                    destroy();
+
+            public:
+                /**
+                 * Get number of active timers
+                 * @return number of active timers
+                 */
+                inline size_t           active() const              { return nActive;       }
+
+                /**
+                 * Get number of wakeups per second during the last measurement period
+                 * @return number of wakeups per second
+                 */
+                inline float            wakeup_rate() const         { return fWakeupRate;   }
+
+                /**
+                 * Get statistics of the timer wheel
+                 * @param stats pointer to store statistics
+                 */
+                void                    get_stats(timer_wheel_stats_t *stats) const;
+
+                /**
+                 * Reset counters of the statistics
+                 */
+                void                    reset_stats();
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_TIMERWHEEL_H_ */
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LSP_PLUG_IN_TK_SYS_WINDOWPOOL_H_
+#define LSP_PLUG_IN_TK_SYS_WINDOWPOOL_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/ws/IDisplay.h>
+#include <lsp-plug.in/ws/IWindow.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+// The default number of hidden native windows kept by the pool
+#define LSP_TK_WINDOW_POOL_CAPACITY     4
+// The number of native windows created when the display is initialized
+#define LSP_TK_WINDOW_POOL_PREWARM      2
+
+namespace lsp
+{
+    namespace tk
+    {
+        class Display;
+
+        /**
+         * Window pool statistics
+         */
+        typedef struct window_pool_stats_t
+        {
+            size_t              nCapacity;      // Maximum number of hidden windows kept by the pool
+            size_t              nFree;          // Number of hidden windows available for reuse
+            size_t              nCreated;       // Overall number of created native windows
+            size_t              nReused;        // Overall number of requests satisfied by pooled windows
+            size_t              nResized;       // Overall number of reused windows which did not match the size class
+            size_t              nDestroyed;     // Overall number of native windows destroyed by the pool
+        } window_pool_stats_t;
+
+        /**
+         * Pool of hidden native windows used by popup windows. Instead of creating
+         * and destroying the native window each time the popup is shown and hidden,
+         * the popup borrows the window from the pool and returns it back. Windows
+         * of the same size class are preferred, so the native back buffer of the
+         * window can be kept between the popups.
+         */
+        class WindowPool
+        {
+            private:
+                WindowPool & operator = (const WindowPool &);
+                WindowPool(const WindowPool &);
+
+            protected:
+                Display                    *pDisplay;       // Display
+                lltl::parray<ws::IWindow>   vFree;          // Hidden windows, the last is most recent
+                size_t                      nCapacity;      // Pool capacity
+                size_t                      nCreated;       // Number of created windows
+                size_t                      nReused;        // Number of reused windows
+                size_t                      nResized;       // Number of reused windows of another size class
+                size_t                      nDestroyed;     // Number of destroyed windows
+
+            protected:
+                static void                 destroy_window(ws::IWindow *wnd);
+                static bool                 same_size_class(ws::IWindow *wnd, ssize_t width, ssize_t height);
+
+                ws::IWindow                *create_window(size_t screen);
+                void                        shrink(size_t count);
+
+            public:
+                explicit WindowPool(Display *dpy);
+                ~WindowPool();
+
+                /**
+                 * Destroy all windows held by the pool
+                 */
+                void                        destroy();
+
+            public:
+                /**
+                 * Create hidden native windows in advance
+                 * @param count number of windows to keep in the pool
+                 * @return status of operation
+                 */
+                status_t                    prewarm(size_t count = LSP_TK_WINDOW_POOL_PREWARM);
+
+                /**
+                 * Acquire hidden native window. The window of the same size class
+                 * is preferred, otherwise any window of the same screen is returned,
+                 * or a new window is created
+                 * @param screen screen the window should be shown on
+                 * @param width estimated width of the window, negative if unknown
+                 * @param height estimated height of the window, negative if unknown
+                 * @return native window or NULL on error
+                 */
+                ws::IWindow                *acquire(size_t screen, ssize_t width = -1, ssize_t height = -1);
+
+                /**
+                 * Hide the native window and return it to the pool. If the pool
+                 * is full, the window is destroyed
+                 * @param wnd native window to return
+                 */
+                void                        release(ws::IWindow *wnd);
+
+                /**
+                 * Destroy all windows held by the pool
+                 */
+                inline void                 flush()                 { shrink(0);            }
+
+                /**
+                 * Get capacity of the pool
+                 * @return maximum number of hidden windows kept by the pool
+                 */
+                inline size_t               capacity() const        { return nCapacity;     }
+
+                /**
+                 * Set capacity of the pool
+                 * @param capacity maximum number of hidden windows kept by the pool,
+                 *   zero disables pooling
+                 */
+                void                        set_capacity(size_t capacity);
+
+                /**
+                 * Get statistics of the pool
+                 * @param stats pointer to store statistics
+                 */
+                void                        get_stats(window_pool_stats_t *stats) const;
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_SYS_WINDOWPOOL_H_ */
@@ -45,6 +45,12 @@ namespace lsp
              */
             resource::Environment  *environment;
 
+            /**
+             * Use headless display which does not connect to the window system
+             * and renders everything to in-memory surfaces
+             */
+            bool                    headless;
+
             /**
              * Default constructor
              */
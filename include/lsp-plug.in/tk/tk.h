@@ -106,6 +106,7 @@
 #include <lsp-plug.in/tk/prop/collection/ColorRanges.h>
 #include <lsp-plug.in/tk/prop/collection/FileFilters.h>
 #include <lsp-plug.in/tk/prop/collection/FloatArray.h>
+#include <lsp-plug.in/tk/prop/collection/ItemList.h>
 #include <lsp-plug.in/tk/prop/collection/StringList.h>
 #include <lsp-plug.in/tk/prop/collection/WidgetList.h>
 #include <lsp-plug.in/tk/prop/collection/WidgetPtr.h>
@@ -117,6 +118,7 @@
 
 // Styles and schemas
 #include <lsp-plug.in/tk/style/StyleSheet.h>
+#include <lsp-plug.in/tk/style/StringPool.h>
 #include <lsp-plug.in/tk/style/Style.h>
 #include <lsp-plug.in/tk/style/IStyleFactory.h>
 #include <lsp-plug.in/tk/style/Schema.h>
@@ -127,9 +129,16 @@
 #include <lsp-plug.in/tk/sys/Slot.h>
 #include <lsp-plug.in/tk/sys/SlotSet.h>
 #include <lsp-plug.in/tk/sys/Timer.h>
+#include <lsp-plug.in/tk/sys/TimerWheel.h>
+#include <lsp-plug.in/tk/sys/SurfacePool.h>
+#include <lsp-plug.in/tk/sys/DisplayList.h>
+#include <lsp-plug.in/tk/sys/StringCache.h>
+#include <lsp-plug.in/tk/sys/FrameScheduler.h>
+#include <lsp-plug.in/tk/sys/WindowPool.h>
 #include <lsp-plug.in/tk/sys/Display.h>
 
 // Utilitary objects
+#include <lsp-plug.in/tk/util/HitIndex.h>
 #include <lsp-plug.in/tk/util/KeyboardHandler.h>
 #include <lsp-plug.in/tk/util/TextCursor.h>
 #include <lsp-plug.in/tk/util/TextDataSink.h>
@@ -154,6 +154,23 @@ namespace lsp
             MI_RADIO        //!< MI_RADIO radio button style
         };
 
+        /**
+         * Flags of lightweight data items stored in ItemList
+         */
+        enum item_flags_t
+        {
+            IF_HIDDEN       = 1 << 0,   //!< IF_HIDDEN item is not shown
+            IF_SELECTED     = 1 << 1,   //!< IF_SELECTED item is selected
+            IF_SEPARATOR    = 1 << 2,   //!< IF_SEPARATOR item is a separator
+            IF_CHECK        = 1 << 3,   //!< IF_CHECK item has check box
+            IF_RADIO        = 1 << 4,   //!< IF_RADIO item has radio button
+            IF_CHECKED      = 1 << 5,   //!< IF_CHECKED check box or radio button is checked
+            IF_BG_COLOR     = 1 << 6,   //!< IF_BG_COLOR item overrides the background color
+            IF_TEXT_COLOR   = 1 << 7,   //!< IF_TEXT_COLOR item overrides the text color
+
+            IF_USER_MASK    = IF_HIDDEN | IF_SELECTED | IF_SEPARATOR | IF_CHECK | IF_RADIO | IF_CHECKED
+        };
+
         /**
          * Function for rendering framebuffer
          */
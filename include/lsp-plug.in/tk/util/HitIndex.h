@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_TK_UTIL_HITINDEX_H_
+#define LSP_PLUG_IN_TK_UTIL_HITINDEX_H_
+
+#ifndef LSP_PLUG_IN_TK_IMPL
+    #error "use <lsp-plug.in/tk/tk.h>"
+#endif
+
+#include <lsp-plug.in/lltl/darray.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        class Widget;
+
+        /**
+         * Hit-test index of child widgets. The index is an augmented interval tree
+         * built over the vertical extents of widget rectangles, so the lookup of the
+         * widget under the pointer takes logarithmic time instead of linear scan.
+         * The index should be rebuilt each time the container realizes it's children.
+         * If several widgets overlap, the one added first to the index is returned.
+         */
+        class HitIndex
+        {
+            protected:
+                typedef struct node_t
+                {
+                    ws::rectangle_t     sRect;      // Rectangle of the widget at the moment of build
+                    Widget             *pWidget;    // Widget
+                    size_t              nOrder;     // Order of the widget in container
+                    ssize_t             nMaxBottom; // Maximum bottom coordinate of the subtree
+                } node_t;
+
+            protected:
+                lltl::darray<node_t>    vNodes;     // Nodes sorted by top coordinate
+                bool                    bDirty;     // Tree needs to be rebuilt
+
+            protected:
+                static ssize_t          cmp_nodes(const node_t *a, const node_t *b);
+
+                ssize_t                 build_tree(size_t first, size_t last);
+                void                    lookup(const node_t **found, size_t first, size_t last,
+                                            ssize_t x, ssize_t y, Widget *parent) const;
+
+            public:
+                explicit HitIndex();
+                HitIndex(const HitIndex &) = delete;
+                HitIndex(HitIndex &&) = delete;
+                ~HitIndex();
+
+                HitIndex & operator = (const HitIndex &) = delete;
+                HitIndex & operator = (HitIndex &&) = delete;
+
+            public:
+                /**
+                 * Remove all widgets from the index
+                 */
+                void                    clear();
+
+                /**
+                 * Add widget to the index using it's current rectangle
+                 * @param w widget to add
+                 * @return status of operation
+                 */
+                status_t                add(Widget *w);
+
+                /**
+                 * Add widget to the index
+                 * @param w widget to add
+                 * @param r area occupied by widget
+                 * @return status of operation
+                 */
+                status_t                add(Widget *w, const ws::rectangle_t *r);
+
+                /**
+                 * Build the index after all widgets have been added
+                 */
+                void                    build();
+
+                /**
+                 * Find the widget under the specified point
+                 * @param x horizontal coordinate
+                 * @param y vertical coordinate
+                 * @param parent if not NULL, only visible children of the parent are looked up
+                 * @return the widget or NULL if there is no widget under the point
+                 */
+                Widget                 *find(ssize_t x, ssize_t y, Widget *parent) const;
+
+                /**
+                 * Get number of widgets in the index
+                 * @return number of widgets in the index
+                 */
+                inline size_t           size() const        { return vNodes.size();         }
+
+                /**
+                 * Check that index is empty
+                 * @return true if index is empty
+                 */
+                inline bool             is_empty() const    { return vNodes.is_empty();     }
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_TK_UTIL_HITINDEX_H_ */
@@ -31,6 +31,7 @@ namespace lsp
     namespace tk
     {
         class Display;
+        class Window;
 
         // Style definition
         namespace style
@@ -63,6 +64,10 @@ namespace lsp
             public:
                 static const w_class_t    metadata;
 
+            protected:
+                friend class SurfacePool;
+                friend class Window;
+
             protected:
                 enum flags_t
                 {
@@ -72,7 +77,9 @@ namespace lsp
                     REDRAW_CHILD    = 1 << 3,       // Need to redraw child only
                     SIZE_INVALID    = 1 << 4,       // Size limit structure is valid
                     RESIZE_PENDING  = 1 << 5,       // The resize request is pending
-                    REALIZE_ACTIVE  = 1 << 6        // Realize is active, no need to trigger for realize
+                    REALIZE_ACTIVE  = 1 << 6,       // Realize is active, no need to trigger for realize
+                    LAYOUT_INVALID  = 1 << 7,       // Allocation of child widgets should be recomputed
+                    SIZE_CHANGED    = 1 << 8        // Size limits or allocation parameters changed since last realize
                 };
 
             protected:
@@ -92,6 +99,11 @@ namespace lsp
                 Display            *pDisplay;               // Pointer to display
                 Widget             *pParent;                // Parent widget
                 ws::ISurface       *pSurface;               // Drawing surface
+                size_t              nSurfaceFrame;          // Frame number of the last surface access
+                Window             *pDirtyWindow;           // Window that holds the widget in the list of dirty widgets
+                ws::rectangle_t     sDrawArea;              // Area passed by the parent at the last render
+                size_t              nDrawSerial;            // Serial number of the last full render of the widget
+                size_t              nParentSerial;          // Serial number of the parent at the last render
 
                 ws::size_limit_t    sLimit;                 // Cached pre-computed size limit
                 ws::rectangle_t     sSize;                  // Real allocated geometry of widget
@@ -146,6 +158,33 @@ namespace lsp
 
                 void                    unlink_widget(Widget *widget);
 
+                /**
+                 * Return the drawing surface of the widget to the display's surface pool
+                 */
+                void                    drop_surface();
+
+                /**
+                 * Ask the frame scheduler of the display to keep the frame rate for the next frame,
+                 * should be called by timers of animations each time they update the widget
+                 */
+                void                    request_animation();
+
+                /**
+                 * Get the next serial number of the full widget render
+                 * @return serial number
+                 */
+                static size_t           next_draw_serial();
+
+                /** Render child widget to the external surface and remember the area,
+                 * so the window can render the child directly when only the child is dirty
+                 *
+                 * @param child child widget to render
+                 * @param surface surface to perform rendering
+                 * @param area the actual area that will be used for drawing
+                 * @param force force child rendering
+                 */
+                void                    render_child(Widget *child, ws::ISurface *s, const ws::rectangle_t *area, bool force);
+
                 /**
                  * Callback on call when property has been change
                  * @param prop property that has been changed
@@ -188,6 +227,17 @@ namespace lsp
                  */
                 virtual status_t        init();
 
+                /** Initialize widget using the initialized widget of the same class as a prototype:
+                 * the style properties are created with the values of the prototype, including
+                 * the values overridden by the prototype. The snapshot of the prototype style is
+                 * shared by all widgets initialized from the same unchanged prototype.
+                 *
+                 * @param prototype prototype widget, if NULL or of different class, the
+                 *   widget is initialized with init()
+                 * @return status of operation
+                 */
+                status_t                init_from(Widget *prototype);
+
                 /** Destroy widget
                  *
                  */
@@ -342,6 +392,13 @@ namespace lsp
                  */
                 inline bool             resize_pending() const              { return nFlags & (SIZE_INVALID | RESIZE_PENDING); }
 
+                /** Check if size limits or allocation parameters of the widget have changed
+                 * since the last realize, so the parent widget should recompute the allocation
+                 *
+                 * @return true if size of the widget has changed
+                 */
+                inline bool             size_changed() const                { return nFlags & SIZE_CHANGED; }
+
                 /** Check that specified window coordinate lies within widget's bounds
                  * Always returns false for invisible widgets
                  *
@@ -505,7 +562,16 @@ namespace lsp
                  */
                 virtual void            query_resize();
 
-                /** Get widget surface
+                /** Query widget for resize because one of it's children requested resize.
+                 * Unlike query_resize(), does not invalidate the allocation of child widgets:
+                 * it will be recomputed only if size limits of some child have changed
+                 *
+                 */
+                virtual void            query_child_resize();
+
+                /** Get widget surface of the widget's size. The returned surface
+                 * is allocated from the display's surface pool and can be larger
+                 * than the widget
                  *
                  * @param s base surface
                  * @return widget surface or NULL
@@ -521,6 +587,17 @@ namespace lsp
                  */
                 ws::ISurface           *get_surface(ws::ISurface *s, ssize_t width, ssize_t height);
 
+                /** Get widget surface
+                 *
+                 * @param s base surface
+                 * @param width requested width
+                 * @param height requested height
+                 * @param exact if false, the surface of size class may be returned
+                 *   which can be larger than the requested area
+                 * @return widget surface or NULL
+                 */
+                ws::ISurface           *get_surface(ws::ISurface *s, ssize_t width, ssize_t height, bool exact);
+
                 /** Render widget to the external surface
                  *
                  * @param surface surface to perform rendering
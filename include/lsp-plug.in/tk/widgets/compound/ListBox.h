@@ -64,8 +64,9 @@ namespace lsp
                 {
                     ws::rectangle_t     a;          // Allocated space for widget
                     ws::rectangle_t     r;          // Realized space for widget
-                    size_t              index;      // Index of the widget
-                    ListBoxItem        *item;       // Widget item contained in the cell
+                    size_t              index;      // Index of the item
+                    ssize_t             data;       // Index of the data item, negative for widget item
+                    ListBoxItem        *item;       // Widget item contained in the cell, NULL for data item
                 } item_t;
 
                 typedef struct alloc_t
@@ -122,7 +123,7 @@ namespace lsp
                 ssize_t                         nCurrIndex;
                 ssize_t                         nLastIndex;
                 size_t                          nKeyScroll;     // Key scroll direction
-                ListBoxItem                    *pHoverItem;     // Hover item
+                ssize_t                         nHoverIndex;    // Hover item index
 
                 Timer                           sKeyTimer;      // Key scroll timer
                 ScrollBar                       sHBar;
@@ -130,8 +131,10 @@ namespace lsp
                 ws::rectangle_t                 sArea;
                 ws::rectangle_t                 sList;
                 lltl::darray<item_t>            vVisible;
+                ListBoxItem                     sDataItem;      // Item which provides shared style for data items
 
                 prop::WidgetList<ListBoxItem>   vItems;
+                prop::ItemList                  vDataItems;     // Lightweight data items
                 prop::WidgetSet<ListBoxItem>    vSelected;
                 prop::CollectionListener        sIListener;
 
@@ -158,6 +161,8 @@ namespace lsp
                 void                    estimate_size(alloc_t *a, const ws::rectangle_t *xr);
                 void                    realize_children();
                 void                    keep_single_selection();
+                void                    clear_selection();
+                bool                    is_selected(const item_t *it);
                 item_t                 *find_item(ssize_t x, ssize_t y);
                 item_t                 *find_by_index(ssize_t index);
                 void                    select_range(ssize_t first, ssize_t last, bool add);
@@ -206,6 +211,7 @@ namespace lsp
 
                 LSP_TK_PROPERTY(WidgetList<ListBoxItem>,    items,      &vItems)
                 LSP_TK_PROPERTY(WidgetSet<ListBoxItem>,     selected,   &vSelected)
+                LSP_TK_PROPERTY(ItemList,                   data_items, &vDataItems)
 
                 LSP_TK_PROPERTY(Font,               font,                       &sFont)
                 LSP_TK_PROPERTY(Integer,            spacing,                    &sSpacing)
@@ -219,6 +225,13 @@ namespace lsp
                 LSP_TK_PROPERTY(Integer,            hscroll_spacing,            &sHScrollSpacing)
                 LSP_TK_PROPERTY(Integer,            vscroll_spacing,            &sVScrollSpacing)
 
+                /**
+                 * Get the item which provides the shared style for all data items,
+                 * may be used to inject the style or to change visual properties
+                 * @return item which provides the shared style
+                 */
+                inline ListBoxItem         *data_item()                 { return &sDataItem;        }
+
             public:
                 virtual Widget             *find_widget(ssize_t x, ssize_t y) override;
                 virtual status_t            add(Widget *child) override;
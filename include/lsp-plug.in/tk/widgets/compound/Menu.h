@@ -72,7 +72,8 @@ namespace lsp
             protected:
                 typedef struct item_t
                 {
-                    MenuItem           *item;       // Menu item
+                    MenuItem           *item;       // Menu item, shared style item for data items
+                    ssize_t             data;       // Index of the data item, negative for widget item
                     padding_t           pad;        // Padding
                     ws::rectangle_t     area;       // Overall area allocated to menu item
                     ws::rectangle_t     check;      // Check box/radio area
@@ -152,7 +153,9 @@ namespace lsp
 
             protected:
                 lltl::parray<MenuItem>  vItems;
+                prop::ItemList          vDataItems;     // Lightweight data items
                 lltl::darray<item_t>    vVisible;       // List of visible items
+                HitIndex                sHitIndex;      // Hit-test index of visible items
 
                 ssize_t                 nSelected;      // Selected menu item
                 ssize_t                 nKeyScroll;     // Key scroll direction
@@ -164,6 +167,7 @@ namespace lsp
                 Window                  sWindow;        // Associated popup window
                 MenuScroll              sUp;            // Up-scroll button
                 MenuScroll              sDown;          // Down-scroll button
+                MenuItem                sDataItem;      // Item which provides shared style for data items
 
                 Timer                   sKeyTimer;      // Key scroll timer
                 Timer                   sMouseTimer;    // Mouse scroll timer
@@ -191,6 +195,7 @@ namespace lsp
             protected:
                 static status_t             key_scroll_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg);
                 static status_t             mouse_scroll_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg);
+                static status_t             slot_on_submit(Widget *sender, void *ptr, void *data);
 
             protected:
                 void                        allocate_items(lltl::darray<item_t> *out, istats_t *stats);
@@ -204,6 +209,10 @@ namespace lsp
                 Menu                       *root_menu();
                 Menu                       *find_menu(const ws::event_t *ev, ws::rectangle_t *xr);
                 bool                        check_rtl_direction();
+                ssize_t                     find_item(ssize_t x, ssize_t y);
+                menu_item_type_t            item_type(MenuItem *mi, ssize_t data);
+                bool                        item_checked(MenuItem *mi, ssize_t data);
+                void                        submit_data_item(ssize_t data);
 
             protected:
                 virtual void                property_changed(Property *prop) override;
@@ -217,6 +226,7 @@ namespace lsp
                 virtual void                select_first_item(bool popup);
                 virtual void                submit_menu_item(MenuItem *item, bool focus);
                 virtual void                sync_scroll(MenuItem *item);
+                virtual void                sync_scroll(const ws::rectangle_t *area);
                 virtual status_t            handle_key_scroll(ssize_t dir);
                 virtual status_t            handle_mouse_scroll(ssize_t dir);
 
@@ -251,11 +261,19 @@ namespace lsp
                 LSP_TK_PROPERTY(Integer,            check_border_radius,        &sCheckBorderRadius)
                 LSP_TK_PROPERTY(Integer,            separator_width,            &sSeparatorWidth)
                 LSP_TK_PROPERTY(Padding,            padding_internal,           &sIPadding)
+                LSP_TK_PROPERTY(ItemList,           data_items,                 &vDataItems)
 
                 LSP_TK_PROPERTY(Rectangle,          trigger_area,               sWindow.trigger_area())
                 LSP_TK_PROPERTY(Integer,            trigger_screen,             sWindow.trigger_screen())
                 LSP_TK_PROPERTY(WidgetPtr<Widget>,  trigger_widget,             sWindow.trigger_widget())
 
+                /**
+                 * Get the item which provides the shared style for all data items,
+                 * may be used to inject the style or to change visual properties
+                 * @return item which provides the shared style
+                 */
+                inline MenuItem            *data_item()                 { return &sDataItem;        }
+
             public:
                 bool                        set_tether(const lltl::darray<tether_t> *list);
                 bool                        set_tether(const tether_t *list, size_t count);
@@ -271,8 +289,19 @@ namespace lsp
                 virtual void                draw(ws::ISurface *s) override;
                 virtual status_t            on_key_down(const ws::event_t *e) override;
                 virtual status_t            on_key_up(const ws::event_t *e) override;
+                virtual status_t            on_mouse_in(const ws::event_t *e) override;
+                virtual status_t            on_mouse_move(const ws::event_t *e) override;
+                virtual status_t            on_mouse_up(const ws::event_t *e) override;
 
             public:
+                /**
+                 * Called when the data item has been submitted, the SLOT_SUBMIT slot
+                 * receives the pointer to the index of the data item as argument
+                 * @param index index of the submitted data item
+                 * @return status of operation
+                 */
+                virtual status_t            on_submit(ssize_t index);
+
                 virtual status_t            insert(Widget *child, size_t index);
                 virtual Widget             *get(size_t index);
 
@@ -71,6 +71,7 @@ namespace lsp
             protected:
                 size_t                      nMFlags;
                 size_t                      nState;
+                bool                        bHorizontal;        // Orientation of cells in vVisible, used for hit-testing
 
                 lltl::darray<cell_t>        vVisible;
                 prop::WidgetList<Widget>    vItems;
@@ -95,6 +96,8 @@ namespace lsp
                 status_t                    allocate_proportional(const ws::rectangle_t *r, lltl::darray<cell_t> &visible);
                 void                        allocate_widget_space(const ws::rectangle_t *r, lltl::darray<cell_t> &visible, ssize_t spacing);
                 void                        realize_children(lltl::darray<cell_t> &visible);
+                bool                        allocation_valid(const ws::rectangle_t *r);
+                ssize_t                     find_cell(ssize_t x, ssize_t y);
 
             protected:
                 static status_t             slot_on_submit(Widget *sender, void *ptr, void *data);
@@ -101,6 +101,8 @@ namespace lsp
             protected:
                 lltl::darray<widget_t>      vItems;     // All list of items
                 alloc_t                     sAlloc;     // Allocation
+                lltl::darray<ssize_t>       vColPos;    // Start coordinates of columns, used for hit-testing
+                lltl::darray<ssize_t>       vRowPos;    // Start coordinates of rows, used for hit-testing
 
                 prop::Integer               sRows;
                 prop::Integer               sColumns;
@@ -127,6 +129,9 @@ namespace lsp
                 status_t                    create_row_col_descriptors(alloc_t *a);
                 static void                 assign_coords(alloc_t *a, const ws::rectangle_t *r);
                 static void                 realize_children(alloc_t *a);
+                bool                        allocation_valid(const ws::rectangle_t *r);
+                static status_t             build_positions(lltl::darray<ssize_t> *pos, lltl::darray<header_t> *vh, ssize_t start);
+                static ssize_t              find_position(lltl::darray<ssize_t> *pos, ssize_t value);
                 status_t                    attach_internal(ssize_t left, ssize_t top, Widget *widget, size_t rows, size_t cols);
                 static cell_t              *alloc_cell(lltl::parray<cell_t> *list);
                 static void                 free_cells(alloc_t *a);
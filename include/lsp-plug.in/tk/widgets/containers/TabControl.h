@@ -51,6 +51,7 @@ namespace lsp
                 prop::Boolean               sHeadingFill;
                 prop::Boolean               sHeadingSpacingFill;
                 prop::Boolean               sAggregateSize;
+                prop::Boolean               sLazySize;              // Lazy size estimation of hidden tabs
                 prop::Pointer               sTabPointer;            // Tab pointer
             LSP_TK_STYLE_DEF_END
         } /* namespae style */
@@ -74,6 +75,12 @@ namespace lsp
                     size_t                  border;         // Border size
                 } tab_t;
 
+                typedef struct limit_t
+                {
+                    tk::Tab                *widget;         // Tab widget
+                    ws::size_limit_t        limit;          // Size limit of the tab when it was selected last time
+                } limit_t;
+
                 enum tab_mode_t
                 {
                     TM_NORMAL,
@@ -83,6 +90,7 @@ namespace lsp
 
             protected:
                 lltl::darray<tab_t>         vVisible;       // List of visible tab headings
+                lltl::darray<limit_t>       vLimits;        // Cached size limits of tabs for lazy size estimation
                 ws::rectangle_t             sArea;          // Internal area for drawing the widget
                 ws::rectangle_t             sBounds;        // External area for drawing widget
                 ws::rectangle_t             sTabArea;       // Location of tab area
@@ -110,6 +118,7 @@ namespace lsp
                 prop::Boolean               sHeadingFill;
                 prop::Boolean               sHeadingSpacingFill;
                 prop::Boolean               sAggregateSize;
+                prop::Boolean               sLazySize;              // Lazy size estimation of hidden tabs
                 prop::Pointer               sTabPointer;            // Tab pointer
 
                 prop::WidgetList<Tab>       vWidgets;
@@ -123,6 +132,9 @@ namespace lsp
                 tk::Tab                    *find_tab(ssize_t x, ssize_t y);
                 void                        draw_tab(ws::ISurface *s, const tab_t *tab, tab_mode_t mode, const ws::rectangle_t *area);
                 void                        do_destroy();
+                limit_t                    *find_limit(const tk::Tab *tab);
+                void                        commit_limit(tk::Tab *tab, const ws::size_limit_t *limit);
+                void                        forget_limit(const tk::Tab *tab);
 
             protected:
                 static void                 on_add_widget(void *obj, Property *prop, void *w);
@@ -166,6 +178,13 @@ namespace lsp
                 LSP_TK_PROPERTY(Boolean,                    heading_fill,               &sHeadingFill)
                 LSP_TK_PROPERTY(Boolean,                    heading_spacing_fill,       &sHeadingSpacingFill)
                 LSP_TK_PROPERTY(Pointer,                    mouse_pointer,              &sTabPointer)
+
+                /**
+                 * Lazy size estimation: tabs that are not selected are neither size-requested nor realized,
+                 * the size limits of tabs cached when they were selected last time are used for size
+                 * aggregation instead. Tabs that were never selected are not taken into account.
+                 */
+                LSP_TK_PROPERTY(Boolean,                    lazy_size,                  &sLazySize)
                 LSP_TK_PROPERTY(WidgetPtr<Tab>,             selected,                   &sSelected)
                 LSP_TK_PROPERTY(WidgetList<Tab>,            widgets,                    &vWidgets)
 
@@ -48,6 +48,7 @@ namespace lsp
                 prop::SizeConstraints   sConstraints;
                 prop::Layout            sLayout;
                 prop::WindowPolicy      sPolicy;
+                prop::Boolean           sEventCoalescing;
             LSP_TK_STYLE_DEF_END
         }
 
@@ -56,6 +57,7 @@ namespace lsp
             protected:
                 friend class Display;
                 friend class Widget;
+                friend class FrameScheduler;
 
                 typedef struct mouse_handler_t
                 {
@@ -71,9 +73,29 @@ namespace lsp
                     Widget             *pWidget;            // Keyboard handler
                 } key_handler_t;
 
+                typedef struct deferred_event_t
+                {
+                    ws::event_t         sEvent;             // The last deferred event
+                    size_t              nCount;             // Number of deferred events, 0 if there is no deferred event
+                } deferred_event_t;
+
             public:
                 static const w_class_t    metadata;
 
+                typedef struct event_stats_t
+                {
+                    size_t              nReceived;          // Number of events received from the window system
+                    size_t              nDispatched;        // Number of events dispatched to widgets
+                    size_t              nMotionMerged;      // Number of mouse motion events merged with next motion events
+                } event_stats_t;
+
+                typedef struct render_stats_t
+                {
+                    size_t              nFull;              // Number of frames rendered by traversing the whole widget tree
+                    size_t              nPartial;           // Number of frames rendered by visiting dirty widgets only
+                    size_t              nDirty;             // Number of widgets rendered directly by partial frames
+                } render_stats_t;
+
             protected:
                 ws::IWindow            *pWindow;            // Underlying window
                 void                   *pNativeHandle;      // Native handle of the window
@@ -81,13 +103,18 @@ namespace lsp
                 Widget                 *pFocused;           // Focused widget
                 bool                    bMapped;
                 bool                    bOverridePointer;
+                bool                    bTitlePending;      // Title should be passed to the window when it becomes visible
+                bool                    bRolePending;       // Role should be passed to the window when it becomes visible
                 float                   fScaling;           // Cached scaling factor
 
                 mouse_handler_t         hMouse;             // Mouse handler
                 key_handler_t           hKeys;              // Key handler
+                deferred_event_t        hDeferred;          // Deferred event
+                event_stats_t           sEventStats;        // Event statistics
+                lltl::parray<Widget>    vDirty;             // Widgets that requested redraw since the last frame
+                render_stats_t          sRenderStats;       // Render statistics
 
                 ws::IWindow            *pActor;
-                Timer                   sRedraw;
 
                 prop::String            sTitle;
                 prop::String            sRole;
@@ -101,17 +128,25 @@ namespace lsp
                 prop::SizeConstraints   sSizeConstraints;
                 prop::Layout            sLayout;
                 prop::WindowPolicy      sPolicy;
+                prop::Boolean           sEventCoalescing;
 
             //---------------------------------------------------------------------------------
             // Slot handlers
             protected:
-                static status_t     tmr_redraw_request(ws::timestamp_t sched, ws::timestamp_t ts, void *args);
                 static status_t     slot_window_close(Widget *sender, void *ptr, void *data);
 
                 status_t            do_render();
                 void                do_destroy();
+                inline bool         render_pending() const          { return (hDeferred.nCount > 0) || (redraw_pending()) || (resize_pending()); }
+                void                request_frame();
                 virtual status_t    sync_size(bool force);
                 status_t            update_pointer();
+                status_t            update_title();
+                status_t            update_role();
+
+                // Event coalescing
+                bool                defer_event(const ws::event_t *e);
+                status_t            dispatch_event(const ws::event_t *e);
 
                 // Mouse operations
                 virtual Widget     *sync_mouse_handler(const ws::event_t *e, bool lookup);
@@ -140,6 +175,39 @@ namespace lsp
                  */
                 void                discard_widget(Widget *w);
 
+                /**
+                 * Add widget to the list of dirty widgets
+                 * @param w widget that requested redraw of its surface
+                 */
+                void                add_dirty(Widget *w);
+
+                /**
+                 * Remove widget from the list of dirty widgets
+                 * @param w widget to remove
+                 */
+                void                remove_dirty(Widget *w);
+
+                /**
+                 * Drop the list of dirty widgets
+                 */
+                void                clear_dirty();
+
+                /**
+                 * Find the topmost widget on the path from the window to the dirty widget that
+                 * should be rendered to redraw the dirty widget
+                 * @param w dirty widget
+                 * @return the widget to render, the window itself if the whole tree should be
+                 *   traversed or NULL if the widget does not belong to the window anymore
+                 */
+                Widget             *dirty_root(Widget *w);
+
+                /**
+                 * Render only dirty widgets and commit redraw of the containers on their paths
+                 * @param s surface to render
+                 * @return true if the frame has been rendered, false if the whole tree should be traversed
+                 */
+                bool                render_dirty(ws::ISurface *s);
+
             //---------------------------------------------------------------------------------
             // Construction and destruction
             public:
@@ -205,6 +273,29 @@ namespace lsp
                 LSP_TK_PROPERTY(WindowPolicy,       policy,             &sPolicy)
                 LSP_TK_PROPERTY(Widget,             child,              pChild)
                 LSP_TK_PROPERTY(Position,           position,           &sPosition)
+                LSP_TK_PROPERTY(Boolean,            event_coalescing,   &sEventCoalescing)
+
+                /**
+                 * Get statistics of the event processing
+                 * @param stats pointer to store statistics
+                 */
+                void                            get_event_stats(event_stats_t *stats) const;
+
+                /**
+                 * Reset statistics of the event processing
+                 */
+                void                            reset_event_stats();
+
+                /**
+                 * Get statistics of the rendering
+                 * @param stats pointer to store statistics
+                 */
+                void                            get_render_stats(render_stats_t *stats) const;
+
+                /**
+                 * Reset statistics of the rendering
+                 */
+                void                            reset_render_stats();
 
             //---------------------------------------------------------------------------------
             // Manipulation
@@ -232,6 +323,18 @@ namespace lsp
 
                 virtual status_t        handle_event(const ws::event_t *e) override;
 
+                virtual void            query_draw(size_t flags = REDRAW_SURFACE) override;
+
+                virtual void            query_resize() override;
+
+                virtual void            query_child_resize() override;
+
+                /**
+                 * Dispatch the deferred mouse motion event to widgets
+                 * @return status of operation
+                 */
+                status_t                flush_events();
+
                 virtual bool            take_focus() override;
 
                 virtual bool            has_parent() const;
@@ -26,6 +26,8 @@
     #error "use <lsp-plug.in/tk/tk.h>"
 #endif
 
+#include <lsp-plug.in/lltl/ptrset.h>
+
 namespace lsp
 {
     namespace tk
@@ -58,6 +60,15 @@ namespace lsp
             public:
                 static const w_class_t    metadata;
 
+                typedef struct draw_list_stats_t
+                {
+                    size_t              nRecorded;          // Number of items drawn by recording the display list
+                    size_t              nReplayed;          // Number of items drawn by replaying the retained display list
+                } draw_list_stats_t;
+
+            protected:
+                friend class GraphItem;
+
             protected:
                 typedef struct w_alloc_t
                 {
@@ -85,8 +96,13 @@ namespace lsp
                 prop::Padding                   sIPadding;      // Internal padding
 
                 ws::ISurface                   *pGlass;         // Cached glass gradient
+                ws::ISurface                   *pStatic;        // Cached static layer
+                bool                            bStaticValid;   // Static layer is valid
+                lltl::ptrset<GraphItem>         vDiscarded;     // Items discarded by collision check
                 ws::rectangle_t                 sCanvas;        // Actual dimensions of the drawing area (with padding)
                 ws::rectangle_t                 sICanvas;       // Actual dimensions of the drawing area (without padding)
+                size_t                          nLayout;        // Version of the layout, changes invalidate display lists of items
+                draw_list_stats_t               sListStats;     // Statistics of display lists
 
             protected:
                 void                        do_destroy();
@@ -106,6 +122,9 @@ namespace lsp
 
                 void                        sync_lists();
                 void                        drop_glass();
+                void                        drop_static();
+                void                        compute_discarded(ws::ISurface *s);
+                ws::ISurface               *render_static(ws::ISurface *s, size_t count, const lsp::Color &c);
 
             public:
                 explicit Graph(Display *dpy);
@@ -132,6 +151,32 @@ namespace lsp
                 LSP_TK_PROPERTY(Color,                      glass_color,        &sGlassColor);
                 LSP_TK_PROPERTY(Padding,                    ipadding,           &sIPadding);
 
+            public:
+                /**
+                 * Request redraw of the static layer, should be called by items which
+                 * belong to the static layer or affect the layout of other items
+                 */
+                void                        query_static_draw();
+
+                /**
+                 * Get version of the graph layout. The version changes each time when the change
+                 * of the graph, it's axes or origins can affect the geometry of other items
+                 *
+                 * @return version of the graph layout
+                 */
+                inline size_t               layout_version() const      { return nLayout;               }
+
+                /**
+                 * Get statistics of display lists of graph items
+                 * @param stats pointer to store statistics
+                 */
+                void                        get_draw_list_stats(draw_list_stats_t *stats) const;
+
+                /**
+                 * Reset statistics of display lists of graph items
+                 */
+                void                        reset_draw_list_stats();
+
             public:
                 /**
                  * Get axis by index, valid only at render time
@@ -193,6 +238,17 @@ namespace lsp
                  */
                 status_t                    axis_to_xy(size_t index, ssize_t *x, ssize_t *y, float value);
 
+                /**
+                 * Get the set of points on axis and return their window coordinates
+                 * @param index axis to perform transformation
+                 * @param x array to store output window X coordinates
+                 * @param y array to store output window Y coordinates
+                 * @param value array of input values to process
+                 * @param count number of values to process
+                 * @return status of operation
+                 */
+                status_t                    axis_to_xy(size_t index, float *x, float *y, const float *value, size_t count);
+
             public:
                 virtual status_t            add(Widget *child) override;
 
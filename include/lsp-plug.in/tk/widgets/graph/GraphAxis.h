@@ -52,6 +52,27 @@ namespace lsp
             public:
                 static const w_class_t    metadata;
 
+            protected:
+                typedef struct transform_t
+                {
+                    bool                        bValid;         // Transform is valid
+                    bool                        bEnabled;       // Transform can be applied
+                    bool                        bLog;           // Logarithmic scale
+                    size_t                      nVersion;       // Unique version of the computed transform
+                    ssize_t                     nLeft;          // Left coordinate of the canvas
+                    ssize_t                     nTop;           // Top coordinate of the canvas
+                    ssize_t                     nRight;         // Right coordinate of the canvas
+                    ssize_t                     nBottom;        // Bottom coordinate of the canvas
+                    float                       fCX;            // Horizontal coordinate of the origin
+                    float                       fCY;            // Vertical coordinate of the origin
+                    float                       fDX;            // Horizontal direction of the axis
+                    float                       fDY;            // Vertical direction of the axis
+                    float                       fLength;        // Length of the axis in pixels
+                    float                       fZero;          // Negated zero value (linear) or inverse of the minimum (log)
+                    float                       fNorm;          // Normalizing factor of the value range
+                    float                       fLow;           // Lower absolute value of the range
+                } transform_t;
+
             protected:
                 prop::Vector2D              sDirection;     // Direction
                 prop::Float                 sMin;           // Minimum value
@@ -64,9 +85,13 @@ namespace lsp
                 prop::Integer               sOrigin;        // Origin index
                 prop::Color                 sColor;         // Color of the axis
 
+                transform_t                 sTransform;     // Cached transform
+
             protected:
                 virtual void                property_changed(Property *prop);
 
+                const transform_t          *transform();
+
             public:
                 explicit GraphAxis(Display *dpy);
                 GraphAxis(const GraphAxis &) = delete;
@@ -91,8 +116,46 @@ namespace lsp
                 LSP_TK_PROPERTY(Color,              color,                  &sColor);
 
             public:
+                /**
+                 * Apply the axis transform to the set of points: move each point along the axis
+                 * by the distance that corresponds to the value. Points of several items can be
+                 * passed in one call, coefficients of the transform are computed only when the
+                 * axis, it's origin or the graph canvas change.
+                 *
+                 * @param x array of horizontal coordinates of points to update
+                 * @param y array of vertical coordinates of points to update
+                 * @param dv array of values
+                 * @param count number of points
+                 * @return true if transform has been applied
+                 */
                 bool                        apply(float *x, float *y, const float *dv, size_t count);
+
+                /**
+                 * Get version of the axis transform. The version changes each time the transform
+                 * is re-computed, so items can cache points projected with apply() and re-use
+                 * them while the version stays the same.
+                 *
+                 * @return version of the transform or 0 if the transform can not be applied
+                 */
+                size_t                      transform_version();
+
+                /**
+                 * Project point on the axis and return the corresponding value
+                 * @param x horizontal coordinate of the point
+                 * @param y vertical coordinate of the point
+                 * @return the value
+                 */
                 float                       project(float x, float y);
+
+                /**
+                 * Project set of points on the axis
+                 * @param v array to store values
+                 * @param x array of horizontal coordinates of points
+                 * @param y array of vertical coordinates of points
+                 * @param count number of points
+                 * @return true if projection has been performed
+                 */
+                bool                        project(float *v, const float *x, const float *y, size_t count);
                 bool                        parallel(float x, float y, float &a, float &b, float &c);
                 void                        ortogonal_shift(float x, float y, float shift, float &nx, float &ny);
                 bool                        angle(float x, float y, float angle, float &a, float &b, float &c);
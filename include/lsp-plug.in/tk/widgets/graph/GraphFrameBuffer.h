@@ -43,6 +43,7 @@ namespace lsp
                 prop::Float                 sVScale;            // Height, proportional to the graph size
                 prop::Color                 sColor;             // Base color
                 prop::GraphFrameFunction    sFunction;          // Function
+                prop::Integer               sPaletteSize;       // Size of the palette lookup table
             LSP_TK_STYLE_DEF_END
         }
 
@@ -68,6 +69,7 @@ namespace lsp
                 prop::Float                 sVScale;            // Height, proportional to the graph size
                 prop::Color                 sColor;             // Base color
                 prop::GraphFrameFunction    sFunction;          // Function
+                prop::Integer               sPaletteSize;       // Size of the palette lookup table, 0 disables the palette, out-of-range values are clamped
 
                 bool                        bClear;             // Perform full cleanup of image
                 size_t                      nRows;              // Cached number of rows
@@ -80,6 +82,13 @@ namespace lsp
                 size_t                      nCapacity;          // RGBA buffer capacity
                 size_t                      nPixels;            // Number of pixels
 
+                uint32_t                   *vPalette;           // Palette lookup table of BGRA32 colors
+                size_t                      nPalette;           // Number of valid entries in the palette
+                size_t                      nPalRequest;        // Palette size requested at the last rebuild
+                size_t                      nPalCapacity;       // Capacity of the palette
+                float                       fPalMin;            // Minimum value mapped by the palette
+                float                       fPalMax;            // Maximum value mapped by the palette
+
             protected:
                 void                        calc_rainbow_color(float *rgba, const float *value, size_t n);
                 void                        calc_fog_color(float *rgba, const float *v, size_t n);
@@ -88,6 +97,8 @@ namespace lsp
                 void                        calc_lightness2(float *rgba, const float *value, size_t n);
 
                 void                        destroy_data();
+                bool                        build_palette(size_t size, float min, float max);
+                void                        convert_row(uint8_t *dst, const float *v, size_t n);
 
                 virtual void                property_changed(Property *prop);
 
@@ -108,6 +119,7 @@ namespace lsp
                 LSP_TK_PROPERTY(Float,                  vscale,             &sVScale)
                 LSP_TK_PROPERTY(Color,                  color,              &sColor)
                 LSP_TK_PROPERTY(GraphFrameFunction,     function,           &sFunction)
+                LSP_TK_PROPERTY(Integer,                palette_size,       &sPaletteSize)
 
             public:
                 virtual void                render(ws::ISurface *s, const ws::rectangle_t *area, bool force);
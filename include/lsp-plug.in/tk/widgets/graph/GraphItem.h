@@ -39,6 +39,7 @@ namespace lsp
                 prop::Boolean       sSmooth;
                 prop::Integer       sPriorityGroup; // Priority group
                 prop::Integer       sPriority;      // Priority inside of a group
+                prop::Boolean       sStaticLayer;   // Item belongs to the static layer
             LSP_TK_STYLE_DEF_END
         }
 
@@ -51,10 +52,40 @@ namespace lsp
                 prop::Boolean       sSmooth;
                 prop::Integer       sPriorityGroup; // Priority group
                 prop::Integer       sPriority;      // Priority inside of a group
+                prop::Boolean       sStaticLayer;   // Item belongs to the static layer
+
+                DisplayList         sDrawList;      // Retained display list
+                Graph              *pListGraph;     // Graph the display list has been recorded for
+                size_t              nDrawVersion;   // Version of the item state, changes on each redraw request
+                size_t              nListVersion;   // Version of the item state the display list has been recorded for
+                size_t              nListLayout;    // Version of the graph layout the display list has been recorded for
 
             protected:
                 virtual void            property_changed(Property *prop) override;
 
+                /**
+                 * Replay the retained display list if neither the item nor the layout of the graph
+                 * have changed since the list has been recorded
+                 * @param cv the parent graph
+                 * @param s surface to draw
+                 * @return true if display list has been replayed
+                 */
+                bool                    replay_draw_list(Graph *cv, ws::ISurface *s);
+
+                /**
+                 * Start recording of the display list
+                 * @param cv the parent graph
+                 * @return pointer to the empty display list
+                 */
+                DisplayList            *begin_draw_list(Graph *cv);
+
+                /**
+                 * Complete recording of the display list and draw it
+                 * @param cv the parent graph
+                 * @param s surface to draw
+                 */
+                void                    end_draw_list(Graph *cv, ws::ISurface *s);
+
             public:
                 explicit GraphItem(Display *dpy);
                 GraphItem(const GraphItem &) = delete;
@@ -73,6 +104,13 @@ namespace lsp
                 LSP_TK_PROPERTY(Integer,        priority_group, &sPriorityGroup);
                 LSP_TK_PROPERTY(Integer,        priority,       &sPriority);
 
+                /**
+                 * Static layer flag: items of the static layer that precede all dynamic items
+                 * are rendered to the cached surface of the graph which is redrawn only
+                 * when one of static items changes
+                 */
+                LSP_TK_PROPERTY(Boolean,        static_layer,   &sStaticLayer);
+
             public:
                 /**
                  * Get the pointer to parent graph
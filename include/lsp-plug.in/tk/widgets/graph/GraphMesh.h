@@ -55,6 +55,21 @@ namespace lsp
                 GraphMesh & operator = (const GraphMesh &);
                 GraphMesh(const GraphMesh &);
 
+            protected:
+                typedef struct geometry_t
+                {
+                    bool                        bValid;         // Cached geometry is valid
+                    size_t                      nVersion;       // Version of the mesh data
+                    size_t                      nSize;          // Number of points
+                    size_t                      nOffset;        // Offset of the first projected point
+                    GraphAxis                  *pXAxis;         // Horizontal axis
+                    GraphAxis                  *pYAxis;         // Vertical axis
+                    size_t                      nXVersion;      // Version of the horizontal axis transform
+                    size_t                      nYVersion;      // Version of the vertical axis transform
+                    float                       fCX;            // Horizontal coordinate of the origin
+                    float                       fCY;            // Vertical coordinate of the origin
+                } geometry_t;
+
             protected:
                 prop::Integer               sOrigin;        // Index of origin
                 prop::Integer               sXAxis;         // Index of X axis
@@ -68,11 +83,13 @@ namespace lsp
 
                 float                      *vBuffer;        // Temporary buffer
                 size_t                      nCapacity;      // Capacity of the temporary buffer
+                geometry_t                  sGeometry;      // Key of the projected geometry stored in the buffer
 
             protected:
                 void                        do_destroy();
                 size_t                      find_offset(size_t *found, const float *v, size_t count, size_t strobes);
                 size_t                      get_length(const float *v, size_t off, size_t count);
+                bool                        project(GraphAxis *xaxis, GraphAxis *yaxis, float cx, float cy, size_t off);
 
             protected:
                 virtual void                property_changed(Property *prop);
@@ -59,6 +59,24 @@ namespace lsp
                 Indicator & operator = (const Indicator &);
                 Indicator(const Indicator &);
 
+            protected:
+                typedef struct glyph_t
+                {
+                    size_t              nState;         // State of segments
+                    ws::ISurface       *pSurface;       // Pre-rendered glyph
+                } glyph_t;
+
+                typedef struct atlas_key_t
+                {
+                    ssize_t             nWidth;         // Width of the digit
+                    ssize_t             nHeight;        // Height of the digit
+                    uint32_t            nColor;         // Color of the glass
+                    uint32_t            nOn;            // Color of lit segments
+                    uint32_t            nOff;           // Color of unlit segments
+                    float               fScaling;       // Scaling factor
+                    bool                bDark;          // Unlit segments are drawn
+                } atlas_key_t;
+
             protected:
                 prop::Color         sColor;         // Color of the indicator
                 prop::Color         sTextColor;     // Color of the text
@@ -77,7 +95,15 @@ namespace lsp
                 ssize_t             nDWidth;        // Width of the digit
                 ssize_t             nDHeight;       // Height of the digit
 
+                lltl::darray<glyph_t>   vGlyphs;    // Glyph atlas: pre-rendered states of segments
+                atlas_key_t         sAtlasKey;      // Parameters the glyphs have been rendered with
+
             protected:
+                void                do_destroy();
+                void                drop_glyphs();
+                void                validate_glyphs(const lsp::Color &color, const lsp::Color &on, const lsp::Color &off);
+                ws::ISurface       *get_glyph(ws::ISurface *s, size_t state, const lsp::Color &color, const lsp::Color &on, const lsp::Color &off);
+                void                draw_glyph(ws::ISurface *s, float x, float y, size_t state, const lsp::Color &color, const lsp::Color &on, const lsp::Color &off);
                 void                draw_digit(ws::ISurface *s, float x, float y, size_t state, const lsp::Color &on, const lsp::Color &off);
                 void                draw_simple(ws::ISurface *s, float x, float y, char ch, const lsp::Color &on, const ws::font_parameters_t *fp);
                 uint8_t             get_char(const LSPString *str, size_t index);
@@ -93,6 +119,7 @@ namespace lsp
                 virtual             ~Indicator();
 
                 virtual status_t    init();
+                virtual void        destroy();
 
             public:
                 LSP_TK_PROPERTY(Color,              color,              &sColor)
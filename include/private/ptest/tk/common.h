@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_PTEST_TK_COMMON_H_
+#define PRIVATE_PTEST_TK_COMMON_H_
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        /** Create and initialize headless display
+         *
+         * @return headless display or NULL on error
+         */
+        tk::Display *create_headless_display();
+
+        /** Create and initialize widget, optionally from the prototype, and add it to the parent
+         *
+         * @param dpy display
+         * @param widgets list of widgets to store the created widget for further destruction
+         * @param parent parent container to add the widget, can be NULL
+         * @param proto prototype to initialize the widget from, can be NULL
+         * @return created widget or NULL on error
+         */
+        template <class T>
+            T *create(tk::Display *dpy, lltl::parray<tk::Widget> *widgets,
+                tk::WidgetContainer *parent = NULL, T *proto = NULL)
+            {
+                T *w = new T(dpy);
+                if (w == NULL)
+                    return NULL;
+                if (!widgets->add(w))
+                {
+                    delete w;
+                    return NULL;
+                }
+                if (w->init_from(proto) != STATUS_OK)
+                    return NULL;
+                if ((parent != NULL) && (parent->add(w) != STATUS_OK))
+                    return NULL;
+
+                return w;
+            }
+
+        /** Destroy widgets in reverse order of creation and the display
+         *
+         * @param dpy display to destroy, can be NULL
+         * @param widgets list of widgets to destroy
+         */
+        void destroy_all(tk::Display *dpy, lltl::parray<tk::Widget> *widgets);
+
+        /** Compute size limits of the widget and realize it at the specified area
+         *
+         * @param w widget to layout
+         * @param width width of the area
+         * @param height height of the area
+         */
+        void layout_widget(tk::Widget *w, ssize_t width, ssize_t height);
+
+        /** Render the widget on the surface
+         *
+         * @param w widget to render
+         * @param s surface to render
+         */
+        void render_widget(tk::Widget *w, ws::ISurface *s);
+    }
+}
+
+#endif /* PRIVATE_PTEST_TK_COMMON_H_ */
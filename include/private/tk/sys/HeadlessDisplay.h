@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TK_SYS_HEADLESSDISPLAY_H_
+#define PRIVATE_TK_SYS_HEADLESSDISPLAY_H_
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include <private/tk/sys/HeadlessSurface.h>
+#include <private/tk/sys/HeadlessWindow.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * Display which does not connect to any window system. Windows exist only in memory,
+         * rendering is performed to in-memory raster surfaces. Window events are queued and
+         * delivered at the next main loop iteration, timers are processed as usual.
+         */
+        class LSP_HIDDEN_MODIFIER HeadlessDisplay: public ws::IDisplay
+        {
+            protected:
+                typedef struct pending_t
+                {
+                    HeadlessWindow     *pWindow;        // Target window
+                    ws::event_t         sEvent;         // Event to deliver
+                } pending_t;
+
+            protected:
+                lltl::darray<pending_t>         vPending;       // Pending events
+                lltl::parray<HeadlessWindow>    vWindows;       // List of windows
+                volatile bool                   bExit;          // Exit flag
+
+            public:
+                explicit HeadlessDisplay();
+                HeadlessDisplay(const HeadlessDisplay &) = delete;
+                HeadlessDisplay(HeadlessDisplay &&) = delete;
+                virtual ~HeadlessDisplay() override;
+
+                HeadlessDisplay & operator = (const HeadlessDisplay &) = delete;
+                HeadlessDisplay & operator = (HeadlessDisplay &&) = delete;
+
+            public:
+                virtual status_t        init(int argc, const char **argv) override;
+                virtual void            destroy() override;
+
+                virtual status_t        main() override;
+                virtual status_t        main_iteration() override;
+                virtual void            quit_main() override;
+                virtual status_t        wait_events(wssize_t millis) override;
+
+                virtual size_t          screens() override;
+                virtual size_t          default_screen() override;
+                virtual status_t        screen_size(size_t screen, ssize_t *w, ssize_t *h) override;
+
+                virtual ws::IWindow    *create_window() override;
+                virtual ws::IWindow    *create_window(size_t screen) override;
+                virtual ws::IWindow    *create_window(void *handle) override;
+                virtual ws::IWindow    *wrap_window(void *handle) override;
+                virtual ws::ISurface   *create_surface(size_t width, size_t height) override;
+
+                virtual bool            get_font_parameters(const ws::Font &f, ws::font_parameters_t *fp) override;
+                virtual bool            get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const char *text) override;
+                virtual bool            get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp,
+                                            const LSPString *text, ssize_t first, ssize_t last) override;
+
+            public:
+                /**
+                 * Queue event for delivery at the next main loop iteration
+                 * @param wnd target window
+                 * @param ev event to deliver
+                 * @return status of operation
+                 */
+                status_t                queue_event(HeadlessWindow *wnd, const ws::event_t *ev);
+
+                /**
+                 * Remove the window and all it's pending events from the display
+                 * @param wnd window to remove
+                 */
+                void                    remove_window(HeadlessWindow *wnd);
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TK_SYS_HEADLESSDISPLAY_H_ */
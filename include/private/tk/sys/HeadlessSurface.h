@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TK_SYS_HEADLESSSURFACE_H_
+#define PRIVATE_TK_SYS_HEADLESSSURFACE_H_
+
+#include <lsp-plug.in/tk/tk.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        /**
+         * In-memory raster surface of the headless display. Clearing, rectangle filling
+         * and drawing of other surfaces are performed on the pixel buffer, other primitives
+         * are handled by the default no-op implementation of ws::ISurface. Font metrics
+         * are estimated from the font size, so the layout does not depend on system fonts.
+         */
+        class LSP_HIDDEN_MODIFIER HeadlessSurface: public ws::ISurface
+        {
+            protected:
+                uint32_t           *vData;          // Pixel buffer
+                uint8_t            *pData;          // Allocated data
+
+            protected:
+                void                fill(ssize_t left, ssize_t top, ssize_t width, ssize_t height, uint32_t color);
+
+            public:
+                explicit HeadlessSurface(size_t width, size_t height);
+                HeadlessSurface(const HeadlessSurface &) = delete;
+                HeadlessSurface(HeadlessSurface &&) = delete;
+                virtual ~HeadlessSurface() override;
+
+                HeadlessSurface & operator = (const HeadlessSurface &) = delete;
+                HeadlessSurface & operator = (HeadlessSurface &&) = delete;
+
+            public:
+                static void         font_parameters(const ws::Font &f, ws::font_parameters_t *fp);
+                static void         text_parameters(const ws::Font &f, ws::text_parameters_t *tp, size_t length);
+                static size_t       utf8_length(const char *text);
+
+            public:
+                virtual ws::ISurface   *create(size_t width, size_t height) override;
+                virtual void            destroy() override;
+
+                virtual void            clear(const lsp::Color &color) override;
+                virtual void            clear_rgb(uint32_t color) override;
+                virtual void            clear_rgba(uint32_t color) override;
+
+                virtual void            fill_rect(const lsp::Color &color, size_t mask, float radius,
+                                            float left, float top, float width, float height) override;
+                virtual void            draw(ws::ISurface *s, float x, float y, float sx, float sy, float a) override;
+
+                virtual bool            get_font_parameters(const ws::Font &f, ws::font_parameters_t *fp) override;
+                virtual bool            get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const char *text) override;
+                virtual bool            get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp,
+                                            const LSPString *text, ssize_t first, ssize_t last) override;
+
+            public:
+                /**
+                 * Get pixel data of the surface
+                 * @return pointer to the first pixel or NULL if surface has been destroyed
+                 */
+                inline const uint32_t  *data() const        { return vData;     }
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TK_SYS_HEADLESSSURFACE_H_ */
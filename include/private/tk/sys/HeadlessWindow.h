@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TK_SYS_HEADLESSWINDOW_H_
+#define PRIVATE_TK_SYS_HEADLESSWINDOW_H_
+
+#include <lsp-plug.in/tk/tk.h>
+#include <private/tk/sys/HeadlessSurface.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        class HeadlessDisplay;
+
+        /**
+         * Window of the headless display: keeps geometry and visibility state and
+         * delivers show, hide and resize events through the event queue of the display
+         */
+        class LSP_HIDDEN_MODIFIER HeadlessWindow: public ws::IWindow
+        {
+            protected:
+                HeadlessDisplay    *pHeadless;      // Owning display
+                HeadlessSurface    *pSurface;       // Drawing surface
+                ws::rectangle_t     sSize;          // Window geometry
+                ws::size_limit_t    sConstraints;   // Size constraints
+                size_t              nScreen;        // Screen number
+                bool                bVisible;       // Visibility flag
+
+            protected:
+                void                drop_surface();
+                void                send_event(size_t type);
+                void                apply_constraints();
+
+            public:
+                explicit HeadlessWindow(HeadlessDisplay *dpy, size_t screen);
+                HeadlessWindow(const HeadlessWindow &) = delete;
+                HeadlessWindow(HeadlessWindow &&) = delete;
+                virtual ~HeadlessWindow() override;
+
+                HeadlessWindow & operator = (const HeadlessWindow &) = delete;
+                HeadlessWindow & operator = (HeadlessWindow &&) = delete;
+
+            public:
+                virtual status_t        init() override;
+                virtual void            destroy() override;
+
+            public:
+                virtual ws::ISurface   *get_surface() override;
+                virtual size_t          screen() override;
+                virtual bool            is_visible() override;
+
+                virtual status_t        move(ssize_t left, ssize_t top) override;
+                virtual status_t        resize(ssize_t width, ssize_t height) override;
+                virtual status_t        set_geometry(const ws::rectangle_t *realize) override;
+                virtual status_t        get_geometry(ws::rectangle_t *realize) override;
+                virtual status_t        get_absolute_geometry(ws::rectangle_t *realize) override;
+
+                virtual status_t        set_size_constraints(const ws::size_limit_t *c) override;
+                virtual status_t        get_size_constraints(ws::size_limit_t *c) override;
+
+                virtual status_t        show() override;
+                virtual status_t        show(ws::IWindow *over) override;
+                virtual status_t        hide() override;
+        };
+
+    } /* namespace tk */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TK_SYS_HEADLESSWINDOW_H_ */
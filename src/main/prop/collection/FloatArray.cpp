@@ -29,29 +29,81 @@ namespace lsp
         FloatArray::FloatArray(prop::Listener *listener):
             Property(listener)
         {
+            pExternal   = NULL;
+            nExtSize    = 0;
+            nVersion    = 0;
         }
 
         FloatArray::~FloatArray()
         {
         }
 
+        void FloatArray::modified()
+        {
+            ++nVersion;
+            sync();
+        }
+
         float FloatArray::get(size_t index) const
         {
+            if (pExternal != NULL)
+                return (index < nExtSize) ? pExternal[index] : 0.0f;
+
             const float *v = vItems.get(index);
             return (v != NULL) ? *v : 0.0f;
         }
 
+        status_t FloatArray::attach(const float *v, size_t count)
+        {
+            if ((v == NULL) && (count > 0))
+                return STATUS_BAD_ARGUMENTS;
+
+            // Release own storage, the data is now provided by the external buffer
+            vItems.flush();
+            pExternal   = v;
+            nExtSize    = (v != NULL) ? count : 0;
+
+            modified();
+            return STATUS_OK;
+        }
+
+        status_t FloatArray::detach()
+        {
+            if (pExternal == NULL)
+                return STATUS_OK;
+
+            if (!vItems.set_n(nExtSize, pExternal))
+                return STATUS_NO_MEM;
+
+            // The contents did not change, only the owner of the data
+            pExternal   = NULL;
+            nExtSize    = 0;
+
+            return STATUS_OK;
+        }
+
         void FloatArray::clear()
         {
+            if (pExternal != NULL)
+            {
+                pExternal   = NULL;
+                nExtSize    = 0;
+                modified();
+                return;
+            }
             if (vItems.size() <= 0)
                 return;
 
             vItems.clear();
-            sync();
+            modified();
         }
 
         status_t FloatArray::resize(size_t size)
         {
+            status_t res = detach();
+            if (res != STATUS_OK)
+                return res;
+
             size_t xsize = vItems.size();
             if (xsize == size)
                 return STATUS_OK;
@@ -59,7 +111,7 @@ namespace lsp
             if (xsize > size)
             {
                 vItems.truncate(size);
-                sync();
+                modified();
                 return STATUS_OK;
             }
 
@@ -69,63 +121,87 @@ namespace lsp
                 return STATUS_NO_MEM;
 
             dsp::fill_zero(v, size);
-            sync();
+            modified();
             return STATUS_OK;
         }
 
         status_t FloatArray::prepend(const float *v, size_t count)
         {
+            status_t res = detach();
+            if (res != STATUS_OK)
+                return res;
+
             float *dst  = vItems.prepend_n(count);
             if (dst == NULL)
                 return STATUS_NO_MEM;
 
             dsp::copy(dst, v, count);
-            sync();
+            modified();
             return STATUS_OK;
         }
 
         status_t FloatArray::append(const float *v, size_t count)
         {
+            status_t res = detach();
+            if (res != STATUS_OK)
+                return res;
+
             float *dst  = vItems.append_n(count);
             if (dst == NULL)
                 return STATUS_NO_MEM;
 
             dsp::copy(dst, v, count);
-            sync();
+            modified();
             return STATUS_OK;
         }
 
         status_t FloatArray::insert(size_t idx, const float *v, size_t count)
         {
+            status_t res = detach();
+            if (res != STATUS_OK)
+                return res;
+
             float *dst  = vItems.insert_n(idx, count);
             if (dst == NULL)
                 return STATUS_NO_MEM;
 
             dsp::copy(dst, v, count);
-            sync();
+            modified();
             return STATUS_OK;
         }
 
         status_t FloatArray::remove(size_t idx, size_t count)
         {
+            status_t res = detach();
+            if (res != STATUS_OK)
+                return res;
+
             if (!vItems.remove_n(idx, count))
                 return STATUS_INVALID_VALUE;
 
-            sync();
+            modified();
             return STATUS_OK;
         }
 
         status_t FloatArray::set(const float *v, size_t count)
         {
+            // The contents are replaced, there is no need to copy the external data
+            pExternal   = NULL;
+            nExtSize    = 0;
+
             if (!vItems.set_n(count, v))
                 return STATUS_NO_MEM;
 
-            sync();
+            modified();
             return STATUS_OK;
         }
 
         status_t FloatArray::set(size_t idx, float v)
         {
+            status_t res = detach();
+            if (res != STATUS_OK)
+                return res;
+
             float *xv = vItems.get(idx);
             if (xv == NULL)
                 return STATUS_INVALID_VALUE;
@@ -133,16 +209,20 @@ namespace lsp
                 return STATUS_OK;
 
             *xv     = v;
-            sync();
+            modified();
             return STATUS_OK;
         }
 
         status_t FloatArray::set(size_t idx, const float *v, size_t count)
         {
+            status_t res = detach();
+            if (res != STATUS_OK)
+                return res;
+
             if (!vItems.set_n(idx, count, v))
                 return STATUS_INVALID_VALUE;
 
-            sync();
+            modified();
             return STATUS_OK;
         }
 
@@ -152,8 +232,10 @@ namespace lsp
                 return;
 
             vItems.swap(src->vItems);
-            sync();
-            src->sync();
+            lsp::swap(pExternal, src->pExternal);
+            lsp::swap(nExtSize, src->nExtSize);
+            modified();
+            src->modified();
         }
     }
 }
@@ -0,0 +1,323 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        ItemList::ItemList(prop::Listener *listener):
+            Property(listener)
+        {
+        }
+
+        ItemList::~ItemList()
+        {
+            do_destroy();
+        }
+
+        void ItemList::do_destroy()
+        {
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+                destroy_item(vItems.uget(i));
+            vItems.flush();
+        }
+
+        bool ItemList::init_item(item_t *item, const LSPString *text, ssize_t tag, size_t flags)
+        {
+            item->sText         = NULL;
+            item->nTag          = tag;
+            item->nFlags        = flags & IF_USER_MASK;
+            item->nBgColor      = 0;
+            item->nTextColor    = 0;
+
+            if ((text == NULL) || (text->is_empty()))
+                return true;
+
+            item->sText         = text->clone_utf8();
+            return item->sText != NULL;
+        }
+
+        void ItemList::destroy_item(item_t *item)
+        {
+            if (item->sText != NULL)
+            {
+                ::free(item->sText);
+                item->sText         = NULL;
+            }
+        }
+
+        const char *ItemList::text(size_t index) const
+        {
+            const item_t *it = vItems.get(index);
+            if (it == NULL)
+                return NULL;
+            return (it->sText != NULL) ? it->sText : "";
+        }
+
+        status_t ItemList::get_text(LSPString *dst, size_t index) const
+        {
+            const item_t *it = vItems.get(index);
+            if (it == NULL)
+                return STATUS_INVALID_VALUE;
+            if (it->sText == NULL)
+            {
+                dst->clear();
+                return STATUS_OK;
+            }
+
+            return (dst->set_utf8(it->sText)) ? STATUS_OK : STATUS_NO_MEM;
+        }
+
+        ssize_t ItemList::tag(size_t index) const
+        {
+            const item_t *it = vItems.get(index);
+            return (it != NULL) ? it->nTag : -1;
+        }
+
+        size_t ItemList::flags(size_t index) const
+        {
+            const item_t *it = vItems.get(index);
+            return (it != NULL) ? it->nFlags : 0;
+        }
+
+        ssize_t ItemList::find_flags(size_t flags, size_t first) const
+        {
+            for (size_t i=first, n=vItems.size(); i<n; ++i)
+            {
+                const item_t *it = vItems.uget(i);
+                if ((it->nFlags & flags) == flags)
+                    return i;
+            }
+            return -STATUS_NOT_FOUND;
+        }
+
+        ssize_t ItemList::find_tag(ssize_t tag) const
+        {
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                const item_t *it = vItems.uget(i);
+                if (it->nTag == tag)
+                    return i;
+            }
+            return -STATUS_NOT_FOUND;
+        }
+
+        bool ItemList::get_bg_color(lsp::Color *dst, size_t index) const
+        {
+            const item_t *it = vItems.get(index);
+            if ((it == NULL) || (!(it->nFlags & IF_BG_COLOR)))
+                return false;
+            dst->set_rgba32(it->nBgColor);
+            return true;
+        }
+
+        bool ItemList::get_text_color(lsp::Color *dst, size_t index) const
+        {
+            const item_t *it = vItems.get(index);
+            if ((it == NULL) || (!(it->nFlags & IF_TEXT_COLOR)))
+                return false;
+            dst->set_rgba32(it->nTextColor);
+            return true;
+        }
+
+        status_t ItemList::add(const LSPString *text, ssize_t tag, size_t flags)
+        {
+            return insert(vItems.size(), text, tag, flags);
+        }
+
+        status_t ItemList::add(const char *text, ssize_t tag, size_t flags)
+        {
+            return insert(vItems.size(), text, tag, flags);
+        }
+
+        status_t ItemList::insert(size_t index, const char *text, ssize_t tag, size_t flags)
+        {
+            LSPString tmp;
+            if ((text != NULL) && (!tmp.set_utf8(text)))
+                return STATUS_NO_MEM;
+            return insert(index, &tmp, tag, flags);
+        }
+
+        status_t ItemList::insert(size_t index, const LSPString *text, ssize_t tag, size_t flags)
+        {
+            if (index > vItems.size())
+                return STATUS_INVALID_VALUE;
+
+            item_t item;
+            if (!init_item(&item, text, tag, flags))
+                return STATUS_NO_MEM;
+            if (!vItems.insert(index, &item))
+            {
+                destroy_item(&item);
+                return STATUS_NO_MEM;
+            }
+
+            sync();
+            return STATUS_OK;
+        }
+
+        status_t ItemList::remove(size_t index)
+        {
+            item_t *it = vItems.get(index);
+            if (it == NULL)
+                return STATUS_INVALID_VALUE;
+
+            destroy_item(it);
+            vItems.remove(index);
+            sync();
+
+            return STATUS_OK;
+        }
+
+        void ItemList::clear()
+        {
+            if (vItems.size() <= 0)
+                return;
+
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+                destroy_item(vItems.uget(i));
+            vItems.clear();
+            sync();
+        }
+
+        status_t ItemList::set_text(size_t index, const char *text)
+        {
+            LSPString tmp;
+            if ((text != NULL) && (!tmp.set_utf8(text)))
+                return STATUS_NO_MEM;
+            return set_text(index, &tmp);
+        }
+
+        status_t ItemList::set_text(size_t index, const LSPString *text)
+        {
+            item_t *it = vItems.get(index);
+            if (it == NULL)
+                return STATUS_INVALID_VALUE;
+
+            char *s = ((text != NULL) && (!text->is_empty())) ? text->clone_utf8() : NULL;
+            if ((s == NULL) && (text != NULL) && (!text->is_empty()))
+                return STATUS_NO_MEM;
+
+            if (it->sText != NULL)
+                ::free(it->sText);
+            it->sText       = s;
+            sync();
+
+            return STATUS_OK;
+        }
+
+        status_t ItemList::set_tag(size_t index, ssize_t tag)
+        {
+            item_t *it = vItems.get(index);
+            if (it == NULL)
+                return STATUS_INVALID_VALUE;
+
+            it->nTag        = tag;
+            return STATUS_OK;
+        }
+
+        status_t ItemList::set_flags(size_t index, size_t flags, bool notify)
+        {
+            item_t *it = vItems.get(index);
+            if (it == NULL)
+                return STATUS_INVALID_VALUE;
+
+            flags           = (it->nFlags & (~IF_USER_MASK)) | (flags & IF_USER_MASK);
+            if (it->nFlags == flags)
+                return STATUS_OK;
+
+            it->nFlags      = flags;
+            if (notify)
+                sync();
+
+            return STATUS_OK;
+        }
+
+        bool ItemList::clear_flags(size_t flags, bool notify)
+        {
+            bool changed    = false;
+            flags          &= IF_USER_MASK;
+
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                item_t *it = vItems.uget(i);
+                if (it->nFlags & flags)
+                {
+                    it->nFlags     &= ~flags;
+                    changed         = true;
+                }
+            }
+
+            if ((changed) && (notify))
+                sync();
+
+            return changed;
+        }
+
+        status_t ItemList::set_bg_color(size_t index, const lsp::Color *c)
+        {
+            item_t *it = vItems.get(index);
+            if (it == NULL)
+                return STATUS_INVALID_VALUE;
+
+            if (c != NULL)
+            {
+                it->nFlags     |= IF_BG_COLOR;
+                it->nBgColor    = c->rgba32();
+            }
+            else
+                it->nFlags     &= ~IF_BG_COLOR;
+
+            sync();
+            return STATUS_OK;
+        }
+
+        status_t ItemList::set_text_color(size_t index, const lsp::Color *c)
+        {
+            item_t *it = vItems.get(index);
+            if (it == NULL)
+                return STATUS_INVALID_VALUE;
+
+            if (c != NULL)
+            {
+                it->nFlags     |= IF_TEXT_COLOR;
+                it->nTextColor  = c->rgba32();
+            }
+            else
+                it->nFlags     &= ~IF_TEXT_COLOR;
+
+            sync();
+            return STATUS_OK;
+        }
+
+        void ItemList::swap(ItemList *src)
+        {
+            if (src == this)
+                return;
+
+            vItems.swap(src->vItems);
+            sync();
+            src->sync();
+        }
+    } /* namespace tk */
+} /* namespace lsp */
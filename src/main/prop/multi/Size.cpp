@@ -203,6 +203,14 @@ namespace lsp
             return (r->nWidth <= 0) || (r->nHeight <= 0);
         }
 
+        bool Size::equals(const ws::rectangle_t *a, const ws::rectangle_t *b)
+        {
+            return (a->nLeft == b->nLeft) &&
+                   (a->nTop == b->nTop) &&
+                   (a->nWidth == b->nWidth) &&
+                   (a->nHeight == b->nHeight);
+        }
+
         void Size::init(ws::rectangle_t *dst, ssize_t left, ssize_t top, ssize_t width, ssize_t height)
         {
             dst->nLeft          = left;
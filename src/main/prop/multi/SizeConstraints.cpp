@@ -499,6 +499,16 @@ namespace lsp
             return true;
         }
 
+        bool SizeConstraints::equals(const ws::size_limit_t *a, const ws::size_limit_t *b)
+        {
+            return (a->nMinWidth == b->nMinWidth) &&
+                   (a->nMinHeight == b->nMinHeight) &&
+                   (a->nMaxWidth == b->nMaxWidth) &&
+                   (a->nMaxHeight == b->nMaxHeight) &&
+                   (a->nPreWidth == b->nPreWidth) &&
+                   (a->nPreHeight == b->nPreHeight);
+        }
+
     } /* namespace tk */
 } /* namespace lsp */
 
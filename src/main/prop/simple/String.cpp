@@ -349,6 +349,55 @@ namespace lsp
             return res;
         }
 
+        StringCache *String::string_cache() const
+        {
+            if (pStyle == NULL)
+                return NULL;
+            Schema *schema = pStyle->schema();
+            if (schema == NULL)
+                return NULL;
+            Display *dpy = schema->display();
+            return (dpy != NULL) ? dpy->string_cache() : NULL;
+        }
+
+        status_t String::fmt_template(LSPString *out, const LSPString *lang, bool fmt_key) const
+        {
+            // Use the shared cache of resolved templates first
+            StringCache *cache = string_cache();
+            const StringCache::template_t *t = ((cache != NULL) && (pDict != NULL)) ?
+                cache->get(pDict, lang, &sText) : NULL;
+
+            if (t != NULL)
+            {
+                // Template is missing in the dictionary, output the key
+                if (!t->bFound)
+                {
+                    if (fmt_key)
+                        return expr::format(out, &sText, &sParams);
+                    return (out->set(&sText)) ? STATUS_OK : STATUS_NO_MEM;
+                }
+                // Template does not contain formatting directives, no formatting is required
+                if (t->bPlain)
+                    return (out->set(&t->sText)) ? STATUS_OK : STATUS_NO_MEM;
+
+                return expr::format(out, &t->sText, &sParams);
+            }
+
+            // Lookup the dictionary directly
+            LSPString templ;
+            status_t res = lookup_template(&templ, lang);
+            if (res == STATUS_NOT_FOUND)
+            {
+                if (fmt_key)
+                    return expr::format(out, &sText, &sParams);
+                return (out->set(&sText)) ? STATUS_OK : STATUS_NO_MEM;
+            }
+            else if (res != STATUS_OK)
+                return res;
+
+            return expr::format(out, &templ, &sParams);
+        }
+
         status_t String::fmt_internal(LSPString *out, const LSPString *lang) const
         {
             // Check that string is not localized
@@ -367,17 +416,10 @@ namespace lsp
             if ((caching) && (nFlags & F_MATCHING))
                 return (out->set(&sCache)) ? STATUS_OK : STATUS_NO_MEM;
 
-            // Lookup template
-            LSPString templ;
-            status_t res = lookup_template(&templ, lang);
-
-            // Still no template? Leave
-            if (res == STATUS_NOT_FOUND)
-                res = expr::format(out, &sText, &sParams);
-            else if (res != STATUS_OK)
+            // Lookup and format the template
+            status_t res = fmt_template(out, lang, true);
+            if (res != STATUS_OK)
                 return res;
-            else
-                res = expr::format(out, &templ, &sParams);
 
             // Format the template
             if ((res == STATUS_OK) && (caching))
@@ -399,28 +441,18 @@ namespace lsp
             else if (nFlags & F_MATCHING)
                 return &sCache;
 
-            // Lookup template
-            LSPString templ;
+            // Lookup and format the template
             status_t res;
-
             if (pStyle != NULL)
             {
                 LSPString lang;
                 if (pStyle->get_string(nAtom, &lang) == STATUS_OK)
-                    res = lookup_template(&templ, &lang);
+                    res = fmt_template(&sCache, &lang, false);
                 else
-                    res = lookup_template(&templ, NULL);
+                    res = fmt_template(&sCache, NULL, false);
             }
             else
-                res = lookup_template(&templ, NULL);
-
-            // Still no template? Leave
-            if (res == STATUS_NOT_FOUND)
-                res = (sCache.set(&sText)) ? STATUS_OK : STATUS_NO_MEM; // By default output dictionary key
-            else if (res != STATUS_OK)
-                return &sCache;
-            else
-                res = expr::format(&sCache, &templ, &sParams);
+                res = fmt_template(&sCache, NULL, false);
 
             // Format the template
             if (res == STATUS_OK)
@@ -51,6 +51,10 @@ namespace lsp
             nStride     = 0;
             bStrobe     = false;
             pPtr        = NULL;
+            nVersion    = 0;
+            vExtX       = NULL;
+            vExtY       = NULL;
+            vExtS       = NULL;
         }
 
         GraphMeshData::~GraphMeshData()
@@ -65,6 +69,9 @@ namespace lsp
             bStrobe     = false;
             nStride     = 0;
             pPtr        = NULL;
+            vExtX       = NULL;
+            vExtY       = NULL;
+            vExtS       = NULL;
         }
 
         void GraphMeshData::commit(atom_t property)
@@ -79,6 +86,7 @@ namespace lsp
             bool strobe;
             if ((property == vAtoms[P_STROBE]) && (pStyle->get_bool(vAtoms[P_STROBE], &strobe) == STATUS_OK))
                 resize_buffer(nSize, strobe);
+            ++nVersion;
 
             // Update/notify listeners
             if (pStyle->config_mode())
@@ -89,6 +97,9 @@ namespace lsp
 
         void GraphMeshData::sync()
         {
+            // Any change of the data passes through here, including touch() after in-place modification
+            ++nVersion;
+
             // Update settings
             if (pStyle != NULL)
             {
@@ -112,6 +123,8 @@ namespace lsp
             // Did not even changed?
             if ((nSize == size) && (bStrobe == strobe))
                 return true;
+            if (!detach())
+                return false;
 
             // Need to re-allocate?
             size_t stride   = lsp::align_size(size*sizeof(float), DATA_ALIGNMENT) / sizeof(float);
@@ -212,6 +225,8 @@ namespace lsp
 
         bool GraphMeshData::set_x(const float *v, size_t size)
         {
+            if (!detach())
+                return false;
             if (!resize_buffer(size, bStrobe))
                 return false;
 
@@ -224,6 +239,8 @@ namespace lsp
 
         bool GraphMeshData::set_y(const float *v, size_t size)
         {
+            if (!detach())
+                return false;
             if (!resize_buffer(size, bStrobe))
                 return false;
 
@@ -238,6 +255,8 @@ namespace lsp
         {
             if (!bStrobe)
                 return false;
+            if (!detach())
+                return false;
             if (!resize_buffer(size, bStrobe))
                 return false;
 
@@ -250,6 +269,8 @@ namespace lsp
 
         bool GraphMeshData::set(const float *x, const float *y, size_t size)
         {
+            if (!detach())
+                return false;
             if (!resize_buffer(size, bStrobe))
                 return false;
 
@@ -263,6 +284,71 @@ namespace lsp
             return true;
         }
 
+        bool GraphMeshData::attach(const float *x, const float *y, const float *s, size_t size)
+        {
+            if ((x == NULL) || (y == NULL))
+                return false;
+
+            // Release own storage, the data is now provided by external buffers
+            if (pPtr != NULL)
+            {
+                lsp::free_aligned(pPtr);
+                pPtr        = NULL;
+            }
+            vData       = NULL;
+            nStride     = 0;
+
+            vExtX       = x;
+            vExtY       = y;
+            vExtS       = s;
+            nSize       = size;
+            bStrobe     = s != NULL;
+
+            sync();
+
+            return true;
+        }
+
+        bool GraphMeshData::detach()
+        {
+            if (vExtX == NULL)
+                return true;
+
+            const float *x  = vExtX;
+            const float *y  = vExtY;
+            const float *s  = vExtS;
+            size_t size     = nSize;
+            bool strobe     = bStrobe;
+
+            // Allocate own storage from scratch
+            vExtX           = NULL;
+            vExtY           = NULL;
+            vExtS           = NULL;
+            nSize           = 0;
+            bStrobe         = false;
+
+            if (!resize_buffer(size, strobe))
+            {
+                vExtX           = x;
+                vExtY           = y;
+                vExtS           = s;
+                nSize           = size;
+                bStrobe         = strobe;
+                return false;
+            }
+
+            // The contents did not change, only the owner of the data
+            if (vData != NULL)
+            {
+                dsp::copy(&vData[0], x, size);
+                dsp::copy(&vData[nStride], y, size);
+                if (s != NULL)
+                    dsp::copy(&vData[nStride*2], s, size);
+            }
+
+            return true;
+        }
+
     } /*namespace tk */
 } /* namespace lsp */
 
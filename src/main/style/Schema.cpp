@@ -57,6 +57,11 @@ namespace lsp
             pDisplay        = dpy;
             nFlags          = 0;
             pRoot           = NULL;
+            nTransaction    = 0;
+            pStyles         = NULL;
+            pApplied        = NULL;
+            pBatch          = NULL;
+            nPass           = 0;
         }
     
         Schema::~Schema()
@@ -69,6 +74,10 @@ namespace lsp
             sInvertMouseHScroll.unbind();
             sInvertMouseVScroll.unbind();
 
+            // Drop pending notifications
+            vPending.flush();
+            nTransaction    = 0;
+
             // Destroy named styles
             vBuiltin.flush();
             for (lltl::iterator<Style> it = vStyles.values(); it; ++it)
@@ -86,8 +95,18 @@ namespace lsp
                 pRoot = NULL;
             }
 
+            // Detach styles of widgets which outlive the schema
+            detach_styles();
+
             // Destroy colors
             destroy_colors();
+
+            // Destroy the copy of applied style sheet
+            if (pApplied != NULL)
+            {
+                delete pApplied;
+                pApplied        = NULL;
+            }
         }
 
         void Schema::destroy_colors()
@@ -299,12 +318,207 @@ namespace lsp
 
             // Apply settings in configuration mode
             nFlags |= S_CONFIGURING;
-            status_t res = apply_internal(sheet, loader);
+            begin();
+            status_t res = (pApplied != NULL) ? apply_changes(sheet, loader) : apply_internal(sheet, loader);
+            end();
             nFlags &= ~S_CONFIGURING;
 
+            // Remember the applied style sheet for computing the difference next time
+            if (res == STATUS_OK)
+            {
+                if (pApplied == NULL)
+                    pApplied    = new StyleSheet();
+                if ((pApplied != NULL) && (pApplied->copy(sheet) == STATUS_OK))
+                    return res;
+            }
+
+            // Force the next call to apply the whole style sheet
+            if (pApplied != NULL)
+            {
+                delete pApplied;
+                pApplied    = NULL;
+            }
+
             return res;
         }
 
+        status_t Schema::begin()
+        {
+            ++nTransaction;
+            return STATUS_OK;
+        }
+
+        status_t Schema::end()
+        {
+            if (nTransaction <= 0)
+                return STATUS_BAD_STATE;
+
+            // Deliver notifications at the end of the outermost transaction only
+            if (nTransaction == 1)
+                deliver_pending();
+            --nTransaction;
+
+            return STATUS_OK;
+        }
+
+        void Schema::link_style(Style *s)
+        {
+            s->pPrevLink    = NULL;
+            s->pNextLink    = pStyles;
+            if (pStyles != NULL)
+                pStyles->pPrevLink  = s;
+            pStyles         = s;
+        }
+
+        void Schema::unlink_style(Style *s)
+        {
+            if (s->pPrevLink != NULL)
+                s->pPrevLink->pNextLink = s->pNextLink;
+            else if (pStyles == s)
+                pStyles         = s->pNextLink;
+            if (s->pNextLink != NULL)
+                s->pNextLink->pPrevLink = s->pPrevLink;
+
+            s->pPrevLink    = NULL;
+            s->pNextLink    = NULL;
+        }
+
+        void Schema::detach_styles()
+        {
+            while (pStyles != NULL)
+            {
+                Style *s        = pStyles;
+                pStyles         = s->pNextLink;
+                s->detach_schema();
+            }
+        }
+
+        void Schema::get_memory_stats(style_memory_stats_t *stats) const
+        {
+            if (stats == NULL)
+                return;
+
+            stats->nStyles          = 0;
+            stats->nProperties      = 0;
+            stats->nDefaults        = 0;
+            stats->nListeners       = 0;
+            stats->nStyleBytes      = 0;
+
+            for (const Style *s = pStyles; s != NULL; s = s->pNextLink)
+                s->get_memory_stats(stats);
+
+            stats->nStrings         = sStrings.size();
+            stats->nStringRefs      = sStrings.references();
+            stats->nStringBytes     = sStrings.bytes();
+        }
+
+        void Schema::defer_notify(Style *s)
+        {
+            if (s->nFlags & Style::S_PENDING)
+                return;
+            if (vPending.add(s))
+                s->nFlags      |= Style::S_PENDING;
+            else
+                s->delayed_notify();
+        }
+
+        void Schema::cancel_notify(Style *s)
+        {
+            vPending.premove(s);
+            s->nFlags      &= ~Style::S_PENDING;
+
+            // Drop the style from the batch which is currently being delivered
+            if (pBatch != NULL)
+            {
+                for (size_t i=0, n=pBatch->size(); i<n; ++i)
+                {
+                    pending_t *p    = pBatch->uget(i);
+                    if (p->pStyle == s)
+                        p->pStyle       = NULL;
+                }
+            }
+        }
+
+        size_t Schema::style_depth(Style *s)
+        {
+            // Depth is computed once per notification pass
+            if (s->nDepthPass == nPass)
+                return s->nDepth;
+
+            size_t depth = 0;
+            for (size_t i=0, n=s->vParents.size(); i<n; ++i)
+            {
+                Style *p = s->vParents.uget(i);
+                if (p != NULL)
+                    depth   = lsp_max(depth, style_depth(p) + 1);
+            }
+
+            s->nDepth       = depth;
+            s->nDepthPass   = nPass;
+
+            return depth;
+        }
+
+        ssize_t Schema::cmp_pending(const pending_t *a, const pending_t *b)
+        {
+            if (a->nDepth != b->nDepth)
+                return (a->nDepth < b->nDepth) ? -1 : 1;
+            return (a->nIndex < b->nIndex) ? -1 : (a->nIndex > b->nIndex) ? 1 : 0;
+        }
+
+        void Schema::deliver_pending()
+        {
+            lltl::parray<Style> list;
+            lltl::darray<pending_t> order;
+
+            // Listeners may issue new changes while being notified, these changes are
+            // collected by the transaction and delivered at the next pass
+            while (vPending.size() > 0)
+            {
+                list.swap(vPending);
+
+                // Start new pass, the inheritance graph may change between passes
+                if ((++nPass) == 0)
+                    nPass           = 1;
+
+                // Sort styles in topological order, keep the order of changes for styles at the same level
+                order.clear();
+                pBatch          = &order;
+                for (size_t i=0, n=list.size(); i<n; ++i)
+                {
+                    Style *s        = list.uget(i);
+
+                    pending_t *p    = order.add();
+                    if (p == NULL)
+                    {
+                        s->nFlags      &= ~Style::S_PENDING;
+                        s->delayed_notify();
+                        continue;
+                    }
+                    p->pStyle       = s;
+                    p->nDepth       = style_depth(s);
+                    p->nIndex       = i;
+                }
+                list.clear();
+                order.qsort(cmp_pending);
+
+                // Deliver notifications. Styles keep the pending flag until they are notified,
+                // so styles destroyed by listeners are removed from the batch
+                for (size_t i=0, n=order.size(); i<n; ++i)
+                {
+                    Style *s        = order.uget(i)->pStyle;
+                    if (s == NULL)
+                        continue;
+                    s->nFlags      &= ~Style::S_PENDING;
+                    s->delayed_notify();
+                }
+                pBatch          = NULL;
+            }
+
+            order.flush();
+            list.flush();
+        }
+
         status_t Schema::create_missing_styles(const StyleSheet *sheet)
         {
             // List all possible styles sheet names
@@ -372,63 +586,34 @@ namespace lsp
             return STATUS_OK;
         }
 
-        bool Schema::check_parents_configured(Style *s)
-        {
-            for (size_t i=0, n=s->parents(); i<n; ++i)
-            {
-                Style *sp = s->parent(i);
-                if ((sp != NULL) && (!sp->configured()))
-                    return false;
-            }
-
-            return true;
-        }
-
         status_t Schema::configure_styles(const StyleSheet *sheet)
         {
-            // List all possible styles sheet names
             status_t res;
-            lltl::parray<LSPString> vss;
-            if (!vStyles.keys(&vss))
-                return STATUS_NO_MEM;
 
-            // Initialize all styles in the order of their inheritance
-            for (size_t i=0; vss.size() > 0; )
+            // The style sheet keeps styles in topological order, so parents
+            // are always configured before children
+            for (size_t i=0, n=sheet->vOrder.size(); i<n; ++i)
             {
-                i                      %= vss.size();
-                LSPString *name         = vss.uget(i);
-                Style *s                = vStyles.get(name);
-
-                // Style does not exists or is already configured?
+                StyleSheet::style_t *xs = sheet->vOrder.uget(i);
+                Style *s                = vStyles.get(&xs->name);
                 if ((s == NULL) || (s->configured()))
-                {
-                    vss.remove(i); // Remove the key
-                    continue;
-                }
-
-                // Is there stylesheet present for this style?
-                StyleSheet::style_t *xs = sheet->vStyles.get(name);
-                if (xs == NULL)
-                {
-                    s->set_configured(true);
-                    vss.remove(i); // Remove the key
                     continue;
-                }
 
-                // Check that parents of this style already have been configured
-                if (check_parents_configured(s))
-                {
-                    //lsp_trace("Configuring style '%s'", name->get_utf8());
-                    if ((res = apply_settings(s, xs)) != STATUS_OK)
-                        return res;
+                //lsp_trace("Configuring style '%s'", xs->name.get_utf8());
+                if ((res = apply_settings(s, xs)) != STATUS_OK)
+                    return res;
+                s->set_configured(true);
+            }
 
+            // Other styles are not present in the style sheet and have nothing to configure
+            lltl::parray<Style> vs;
+            if (!vStyles.values(&vs))
+                return STATUS_NO_MEM;
+            for (size_t i=0, n=vs.size(); i<n; ++i)
+            {
+                Style *s = vs.uget(i);
+                if (s != NULL)
                     s->set_configured(true);
-                    vss.remove(i); // Remove the key
-                    continue;
-                }
-
-                // Increment the position
-                ++i;
             }
 
             return STATUS_OK;
@@ -503,69 +688,71 @@ namespace lsp
             if (!xs->properties.keys(&pnames))
                 return STATUS_NO_MEM;
 
-            property_value_t v;
             status_t res;
-
             for (size_t i=0, n=pnames.size(); i<n; ++i)
             {
                 LSPString *name         = pnames.uget(i);
                 LSPString *value        = xs->properties.get(name);
-                property_type_t type    = s->get_type(name);
+                if ((res = apply_setting(s, name, value)) != STATUS_OK)
+                    return res;
+            }
 
-//                lsp_trace("  %s = %s [%d]",
-//                    name->get_utf8(),
-//                    value->get_utf8(),
-//                    int(pAtoms->atom_id(name))
-//                );
+            return STATUS_OK;
+        }
 
-                if (parse_property_value(&v, value, type) == STATUS_OK)
-                {
-                    bool over = s->set_override(true);
-                    switch (v.type)
-                    {
-                        case PT_BOOL:   res = s->set_bool(name, v.bvalue);      break;
-                        case PT_INT:    res = s->set_int(name, v.ivalue);       break;
-                        case PT_FLOAT:  res = s->set_float(name, v.fvalue);     break;
-                        case PT_STRING: res = s->set_string(name, &v.svalue);   break;
-                        default:        res = STATUS_OK;
-                    }
-                    s->set_override(over);
+        status_t Schema::apply_setting(Style *s, const LSPString *name, const LSPString *value)
+        {
+            property_value_t v;
+            status_t res            = STATUS_OK;
+            property_type_t type    = s->get_type(name);
 
-                    if (res != STATUS_OK)
-                        return res;
-                }
+//            lsp_trace("  %s = %s [%d]",
+//                name->get_utf8(),
+//                value->get_utf8(),
+//                int(pAtoms->atom_id(name))
+//            );
+
+            if (parse_property_value(&v, value, type) != STATUS_OK)
+                return STATUS_OK;
+
+            bool over = s->set_override(true);
+            switch (v.type)
+            {
+                case PT_BOOL:   res = s->set_bool(name, v.bvalue);      break;
+                case PT_INT:    res = s->set_int(name, v.ivalue);       break;
+                case PT_FLOAT:  res = s->set_float(name, v.fvalue);     break;
+                case PT_STRING: res = s->set_string(name, &v.svalue);   break;
+                default:        res = STATUS_OK;
             }
+            s->set_override(over);
 
-            return STATUS_OK;
+            return res;
         }
 
-        status_t Schema::apply_relations(Style *s, const lltl::parray<LSPString> *parents)
+        Style *Schema::resolve_parent(const LSPString *name)
         {
-            status_t res;
+            return (name->equals_ascii("root")) ? pRoot : vStyles.get(name);
+        }
 
+        status_t Schema::resolve_parents(lltl::parray<Style> *dst, const lltl::parray<LSPString> *parents)
+        {
             for (size_t i=0, n=parents->size(); i<n; ++i)
             {
-                const LSPString *parent = parents->uget(i);
-                Style *ps = (parent->equals_ascii("root")) ? pRoot : vStyles.get(parent);
-                if (ps != NULL)
-                {
-//                    lsp_trace("  parent: %s", parent->get_utf8());
-                    if ((res = s->add_parent(ps)) != STATUS_OK)
-                        return res;
-                }
+                Style *ps = resolve_parent(parents->uget(i));
+                if ((ps != NULL) && (!dst->add(ps)))
+                    return STATUS_NO_MEM;
             }
 
             return STATUS_OK;
         }
 
-        status_t Schema::apply_relations(Style *s, const char *list)
+        status_t Schema::resolve_parents(lltl::parray<Style> *dst, const char *list)
         {
-            status_t res;
             LSPString parent, text;
             if (!text.set_utf8(list))
                 return STATUS_NO_MEM;
 
-            // Parse list of
+            // Parse comma-separated list of parents
             ssize_t first = 0, last = -1, len = text.length();
 
             while (true)
@@ -578,15 +765,11 @@ namespace lsp
                 }
 
                 if (!parent.set(&text, first, last))
-                    return false;
+                    return STATUS_NO_MEM;
 
-                Style *ps = (parent.equals_ascii("root")) ? pRoot : vStyles.get(&parent);
-                if (ps != NULL)
-                {
-//                    lsp_trace("  parent: %s", parent.get_utf8());
-                    if ((res = s->add_parent(ps)) != STATUS_OK)
-                        return res;
-                }
+                Style *ps = resolve_parent(&parent);
+                if ((ps != NULL) && (!dst->add(ps)))
+                    return STATUS_NO_MEM;
 
                 first = last + 1;
             }
@@ -595,17 +778,370 @@ namespace lsp
             if (last > first)
             {
                 if (!parent.set(&text, first, last))
+                    return STATUS_NO_MEM;
+
+                Style *ps = resolve_parent(&parent);
+                if ((ps != NULL) && (!dst->add(ps)))
+                    return STATUS_NO_MEM;
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t Schema::apply_relations(Style *s, const lltl::parray<LSPString> *parents)
+        {
+            status_t res;
+            lltl::parray<Style> vs;
+            if ((res = resolve_parents(&vs, parents)) != STATUS_OK)
+                return res;
+
+            for (size_t i=0, n=vs.size(); i<n; ++i)
+            {
+                if ((res = s->add_parent(vs.uget(i))) != STATUS_OK)
+                    return res;
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t Schema::apply_relations(Style *s, const char *list)
+        {
+            status_t res;
+            lltl::parray<Style> vs;
+            if ((res = resolve_parents(&vs, list)) != STATUS_OK)
+                return res;
+
+            for (size_t i=0, n=vs.size(); i<n; ++i)
+            {
+                if ((res = s->add_parent(vs.uget(i))) != STATUS_OK)
+                    return res;
+            }
+
+            return STATUS_OK;
+        }
+
+        bool Schema::same_parents(Style *s, const lltl::parray<Style> *parents)
+        {
+            if (s->parents() != parents->size())
+                return false;
+
+            for (size_t i=0, n=parents->size(); i<n; ++i)
+                if (s->parent(i) != parents->uget(i))
                     return false;
 
-                Style *ps = (parent.equals_ascii("root")) ? pRoot : vStyles.get(&parent);
-                if (ps != NULL)
+            return true;
+        }
+
+        bool Schema::same_fonts(const StyleSheet *a, const StyleSheet *b)
+        {
+            if (a->vFonts.size() != b->vFonts.size())
+                return false;
+
+            lltl::parray<LSPString> vk;
+            if (!a->vFonts.keys(&vk))
+                return false;
+
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                const LSPString *key        = vk.uget(i);
+                const StyleSheet::font_t *fa= a->vFonts.get(key);
+                const StyleSheet::font_t *fb= b->vFonts.get(key);
+                if ((fa == NULL) || (fb == NULL))
+                    return false;
+                if ((fa->alias != fb->alias) ||
+                    (!fa->name.equals(&fb->name)) ||
+                    (!fa->path.equals(&fb->path)))
+                    return false;
+            }
+
+            return true;
+        }
+
+        status_t Schema::update_colors(const StyleSheet *sheet, lltl::parray<LSPString> *changed)
+        {
+            // Add new colors and update existing ones
+            lltl::parray<LSPString> vk;
+            if (!sheet->vColors.keys(&vk))
+                return STATUS_NO_MEM;
+
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                LSPString *key      = vk.uget(i);
+                lsp::Color *color   = sheet->vColors.get(key);
+                if ((key == NULL) || (color == NULL))
+                    return STATUS_BAD_STATE;
+
+                lsp::Color *xc      = vColors.get(key);
+                if (xc == NULL)
+                {
+                    if ((xc = new lsp::Color(color)) == NULL)
+                        return STATUS_NO_MEM;
+                    if (!vColors.create(key, xc))
+                    {
+                        delete xc;
+                        return STATUS_NO_MEM;
+                    }
+                }
+                else if (xc->rgba32() != color->rgba32())
+                    xc->copy(color);
+                else
+                    continue;
+
+                if (!changed->add(key))
+                    return STATUS_NO_MEM;
+            }
+
+            // Remove colors that are not present in the new sheet
+            vk.clear();
+            if (!pApplied->vColors.keys(&vk))
+                return STATUS_NO_MEM;
+
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                LSPString *key      = vk.uget(i);
+                if (sheet->vColors.contains(key))
+                    continue;
+
+                lsp::Color *xc      = NULL;
+                if (vColors.remove(key, &xc))
+                {
+                    if (xc != NULL)
+                        delete xc;
+                    if (!changed->add(key))
+                        return STATUS_NO_MEM;
+                }
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t Schema::update_relations(const StyleSheet *sheet)
+        {
+            status_t res;
+            lltl::parray<LSPString> vk, vn;
+            lltl::parray<Style> vs, parents;
+
+            // Find styles which have changed the list of parents
+            if (!vStyles.keys(&vk))
+                return STATUS_NO_MEM;
+            if (!vk.add(static_cast<LSPString *>(NULL))) // Root style
+                return STATUS_NO_MEM;
+
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                LSPString *name         = vk.uget(i);
+                Style *s                = (name != NULL) ? vStyles.get(name) : pRoot;
+                if (s == NULL)
+                    continue;
+
+                const StyleSheet::style_t *xs = (name != NULL) ? sheet->vStyles.get(name) : sheet->pRoot;
+                parents.clear();
+                if (xs != NULL)
+                    res = resolve_parents(&parents, &xs->parents);
+                else if (name == NULL)
+                    res = STATUS_OK;
+                else
                 {
-//                    lsp_trace("  parent: %s", parent.get_utf8());
-                    if ((res = s->add_parent(ps)) != STATUS_OK)
+                    const char *default_parents = s->default_parents();
+                    res = resolve_parents(&parents, (default_parents != NULL) ? default_parents : "root");
+                }
+                if (res != STATUS_OK)
+                    return res;
+
+                if (same_parents(s, &parents))
+                    continue;
+                if ((!vs.add(s)) || (!vn.add(name)))
+                    return STATUS_NO_MEM;
+            }
+
+            // Unlink all changed styles first to avoid temporary inheritance loops
+            for (size_t i=0, n=vs.size(); i<n; ++i)
+            {
+                if ((res = vs.uget(i)->remove_all_parents()) != STATUS_OK)
+                    return res;
+            }
+
+            // Link changed styles to the new parents
+            for (size_t i=0, n=vs.size(); i<n; ++i)
+            {
+                Style *s                = vs.uget(i);
+                LSPString *name         = vn.uget(i);
+                const StyleSheet::style_t *xs = (name != NULL) ? sheet->vStyles.get(name) : sheet->pRoot;
+                if (xs != NULL)
+                    res = apply_relations(s, &xs->parents);
+                else if (name == NULL)
+                    res = STATUS_OK;
+                else
+                {
+                    const char *default_parents = s->default_parents();
+                    res = apply_relations(s, (default_parents != NULL) ? default_parents : "root");
+                }
+                if (res != STATUS_OK)
+                    return res;
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t Schema::update_settings(Style *s, const StyleSheet::style_t *xs, const StyleSheet::style_t *old)
+        {
+            status_t res;
+            lltl::parray<LSPString> pnames;
+
+            // Apply new and changed properties
+            if (xs != NULL)
+            {
+                if (!xs->properties.keys(&pnames))
+                    return STATUS_NO_MEM;
+
+                for (size_t i=0, n=pnames.size(); i<n; ++i)
+                {
+                    LSPString *name         = pnames.uget(i);
+                    LSPString *value        = xs->properties.get(name);
+                    LSPString *prev         = (old != NULL) ? old->properties.get(name) : NULL;
+                    if ((prev != NULL) && (prev->equals(value)))
+                        continue;
+
+                    if ((res = apply_setting(s, name, value)) != STATUS_OK)
+                        return res;
+                }
+            }
+
+            // Reset properties that are not defined by the style sheet anymore
+            if (old != NULL)
+            {
+                pnames.clear();
+                if (!old->properties.keys(&pnames))
+                    return STATUS_NO_MEM;
+
+                for (size_t i=0, n=pnames.size(); i<n; ++i)
+                {
+                    LSPString *name         = pnames.uget(i);
+                    if ((xs != NULL) && (xs->properties.contains(name)))
+                        continue;
+
+                    res = s->set_default(name);
+                    if ((res != STATUS_OK) && (res != STATUS_NOT_FOUND))
                         return res;
                 }
             }
 
+            s->set_configured(true);
+            return STATUS_OK;
+        }
+
+        static inline bool is_word_separator(char c)
+        {
+            switch (c)
+            {
+                case ' ': case '\t': case '\n': case '\r':
+                case ',': case ';': case '(': case ')':
+                    return true;
+                default:
+                    break;
+            }
+            return false;
+        }
+
+        bool Schema::references_color(const char *value, const lltl::parray<LSPString> *names)
+        {
+            // Color is referenced by its name as a whole word of the value
+            for (const char *p = value; *p != '\0'; )
+            {
+                while ((*p != '\0') && (is_word_separator(*p)))
+                    ++p;
+                const char *word    = p;
+                while ((*p != '\0') && (!is_word_separator(*p)))
+                    ++p;
+
+                size_t len          = p - word;
+                if (len <= 0)
+                    continue;
+
+                for (size_t i=0, n=names->size(); i<n; ++i)
+                {
+                    const char *name    = names->uget(i)->get_utf8();
+                    if ((name != NULL) && (strlen(name) == len) && (memcmp(word, name, len) == 0))
+                        return true;
+                }
+            }
+
+            return false;
+        }
+
+        void Schema::renotify_colors(const lltl::parray<LSPString> *changed)
+        {
+            if (changed->is_empty())
+                return;
+
+            // Properties referencing the changed colors by name keep the same text
+            // value, so their listeners need to parse the value again
+            for (Style *s = pStyles; s != NULL; s = s->pNextLink)
+            {
+                for (size_t i=0, n=s->vProperties.size(); i<n; ++i)
+                {
+                    Style::property_t *p    = s->vProperties.uget(i);
+                    if ((p->type != PT_STRING) || (p->v.sValue == NULL))
+                        continue;
+
+                    if (references_color(p->v.sValue, changed))
+                        s->notify_listeners(p);
+                }
+            }
+        }
+
+        status_t Schema::apply_changes(const StyleSheet *sheet, resource::ILoader *loader)
+        {
+            status_t res;
+
+            // Reload fonts only if the set of fonts has changed
+            if ((pDisplay != NULL) && (!same_fonts(sheet, pApplied)))
+            {
+                pDisplay->display()->remove_all_fonts();
+                load_fonts_from_sheet(sheet, loader);
+            }
+
+            // Update colors
+            lltl::parray<LSPString> changed;
+            if ((res = update_colors(sheet, &changed)) != STATUS_OK)
+                return res;
+
+            // Create missing styles and update relations which have changed
+            if ((res = create_missing_styles(sheet)) != STATUS_OK)
+                return res;
+            if ((res = update_relations(sheet)) != STATUS_OK)
+                return res;
+
+            // Update properties of root style and other styles in topological order
+            if ((res = update_settings(pRoot, sheet->pRoot, pApplied->pRoot)) != STATUS_OK)
+                return res;
+            for (size_t i=0, n=sheet->vOrder.size(); i<n; ++i)
+            {
+                StyleSheet::style_t *xs = sheet->vOrder.uget(i);
+                Style *s                = vStyles.get(&xs->name);
+                if (s == NULL)
+                    continue;
+                if ((res = update_settings(s, xs, pApplied->vStyles.get(&xs->name))) != STATUS_OK)
+                    return res;
+            }
+
+            // Reset properties of styles that have been removed from the style sheet
+            lltl::parray<LSPString> vk;
+            if (!pApplied->vStyles.keys(&vk))
+                return STATUS_NO_MEM;
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                LSPString *name         = vk.uget(i);
+                Style *s                = vStyles.get(name);
+                if ((s == NULL) || (sheet->vStyles.contains(name)))
+                    continue;
+                if ((res = update_settings(s, NULL, pApplied->vStyles.get(name))) != STATUS_OK)
+                    return res;
+            }
+
+            // Notify listeners of properties that reference changed colors
+            renotify_colors(&changed);
+
             return STATUS_OK;
         }
 
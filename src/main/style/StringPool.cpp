@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/tk/tk.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        static const char EMPTY_STRING[]        = "";
+        static constexpr size_t INITIAL_BINS    = 64;
+
+        StringPool::StringPool()
+        {
+            vBins       = NULL;
+            nBins       = 0;
+            nItems      = 0;
+            nRefs       = 0;
+            nBytes      = 0;
+        }
+
+        StringPool::~StringPool()
+        {
+            destroy();
+        }
+
+        void StringPool::destroy()
+        {
+            if (vBins != NULL)
+            {
+                for (size_t i=0; i<nBins; ++i)
+                {
+                    for (entry_t *e = vBins[i]; e != NULL; )
+                    {
+                        entry_t *next   = e->pNext;
+                        ::free(e);
+                        e               = next;
+                    }
+                }
+
+                ::free(vBins);
+                vBins       = NULL;
+            }
+
+            nBins       = 0;
+            nItems      = 0;
+            nRefs       = 0;
+            nBytes      = 0;
+        }
+
+        const char *StringPool::empty()
+        {
+            return EMPTY_STRING;
+        }
+
+        size_t StringPool::hash(const char *s, size_t *len)
+        {
+            // FNV-1a hash function
+            size_t h        = 2166136261U;
+            const char *p   = s;
+            for ( ; *p != '\0'; ++p)
+                h               = (h ^ uint8_t(*p)) * 16777619U;
+
+            *len            = p - s;
+            return h;
+        }
+
+        bool StringPool::grow()
+        {
+            size_t bins         = (nBins > 0) ? nBins << 1 : INITIAL_BINS;
+            entry_t **v         = static_cast<entry_t **>(::calloc(bins, sizeof(entry_t *)));
+            if (v == NULL)
+                return false;
+
+            // Re-distribute entries, the number of bins is always a power of two
+            for (size_t i=0; i<nBins; ++i)
+            {
+                for (entry_t *e = vBins[i]; e != NULL; )
+                {
+                    entry_t *next       = e->pNext;
+                    size_t idx          = e->nHash & (bins - 1);
+                    e->pNext            = v[idx];
+                    v[idx]              = e;
+                    e                   = next;
+                }
+            }
+
+            if (vBins != NULL)
+                ::free(vBins);
+            vBins               = v;
+            nBins               = bins;
+
+            return true;
+        }
+
+        const char *StringPool::intern(const char *s)
+        {
+            if (s == NULL)
+                return NULL;
+            if ((s == EMPTY_STRING) || (s[0] == '\0'))
+                return EMPTY_STRING;
+
+            // Lookup for existing string
+            size_t len;
+            size_t h            = hash(s, &len);
+            if (nBins > 0)
+            {
+                for (entry_t *e = vBins[h & (nBins - 1)]; e != NULL; e = e->pNext)
+                {
+                    if ((e->nHash != h) || (e->nLength != len))
+                        continue;
+
+                    char *str           = data(e);
+                    if (::memcmp(str, s, len) != 0)
+                        continue;
+
+                    ++e->nRefs;
+                    ++nRefs;
+                    return str;
+                }
+            }
+
+            // Grow the hash table if needed
+            if ((nItems >= nBins) && (!grow()))
+                return NULL;
+
+            // Allocate new entry
+            size_t bytes        = sizeof(entry_t) + len + 1;
+            entry_t *e          = static_cast<entry_t *>(::malloc(bytes));
+            if (e == NULL)
+                return NULL;
+
+            char *str           = data(e);
+            ::memcpy(str, s, len + 1);
+            e->nHash            = h;
+            e->nRefs            = 1;
+            e->nLength          = len;
+
+            size_t idx          = h & (nBins - 1);
+            e->pNext            = vBins[idx];
+            vBins[idx]          = e;
+
+            ++nItems;
+            ++nRefs;
+            nBytes             += bytes;
+
+            return str;
+        }
+
+        const char *StringPool::acquire(const char *s)
+        {
+            if ((s == NULL) || (s == EMPTY_STRING))
+                return s;
+
+            ++entry(s)->nRefs;
+            ++nRefs;
+            return s;
+        }
+
+        void StringPool::release(const char *s)
+        {
+            if ((s == NULL) || (s == EMPTY_STRING))
+                return;
+
+            entry_t *e          = entry(s);
+            --nRefs;
+            if ((--e->nRefs) > 0)
+                return;
+
+            // Unlink the entry from the bin
+            entry_t **pe        = &vBins[e->nHash & (nBins - 1)];
+            while ((*pe != NULL) && (*pe != e))
+                pe                  = &(*pe)->pNext;
+            if (*pe != NULL)
+                *pe                 = e->pNext;
+
+            --nItems;
+            nBytes             -= sizeof(entry_t) + e->nLength + 1;
+            ::free(e);
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
@@ -33,11 +33,24 @@ namespace lsp
             nFlags      = 0;
             sName       = (name != NULL)    ? strdup(name)      : NULL;
             sDflParents = (parents != NULL) ? strdup(parents)   : NULL;
+            pPrevLink   = NULL;
+            pNextLink   = NULL;
+            nVersion    = 0;
+            pSnapshot   = NULL;
+            pPrototype  = NULL;
+            nDepth      = 0;
+            nDepthPass  = 0;
+
+            if (pSchema != NULL)
+                pSchema->link_style(this);
         }
         
         Style::~Style()
         {
             do_destroy();
+
+            if (pSchema != NULL)
+                pSchema->unlink_style(this);
         }
 
         status_t Style::init()
@@ -52,6 +65,12 @@ namespace lsp
 
         void Style::do_destroy()
         {
+            // Release snapshots
+            release_snapshot(pSnapshot);
+            release_snapshot(pPrototype);
+            pSnapshot   = NULL;
+            pPrototype  = NULL;
+
             // Unlock all pending transactions
             vLocks.flush();
             delayed_notify();
@@ -78,12 +97,15 @@ namespace lsp
 
             // Synchronize state with listeners and remove them
             synchronize();
+            if ((nFlags & S_PENDING) && (pSchema != NULL))
+                pSchema->cancel_notify(this);
             vListeners.flush();
 
             // Destroy stored properties
             for (size_t i=0, n=vProperties.size(); i<n; ++i)
                 undef_property(vProperties.uget(i));
             vProperties.flush();
+            vDefaults.flush();
 
             // Destroy name
             if (sName != NULL)
@@ -105,27 +127,193 @@ namespace lsp
             if (property == NULL)
                 return;
 
-            switch (property->type)
+            ++nVersion;
+            drop_default_value(property);
+            if (property->type == PT_STRING)
             {
-                case PT_STRING:
-                    if (property->v.sValue != NULL)
-                    {
-                        ::free(property->v.sValue);
-                        property->v.sValue      = NULL;
-                    }
-                    if (property->dv.sValue != NULL)
-                    {
-                        ::free(property->dv.sValue);
-                        property->dv.sValue     = NULL;
-                    }
-                    break;
-                default:
-                    break;
+                release_string(property->v.sValue);
+                property->v.sValue      = NULL;
             }
 
             property->type = PT_UNKNOWN;
         }
 
+        StringPool *Style::strings()
+        {
+            return (pSchema != NULL) ? &pSchema->sStrings : NULL;
+        }
+
+        const char *Style::acquire_string(const char *s)
+        {
+            // Styles detached from the schema do not keep interned strings
+            return (pSchema != NULL) ? pSchema->sStrings.acquire(s) : StringPool::empty();
+        }
+
+        void Style::release_string(const char *s)
+        {
+            if (pSchema != NULL)
+                pSchema->sStrings.release(s);
+        }
+
+        void Style::detach_schema()
+        {
+            // Snapshots refer to the string pool of the schema
+            release_snapshot(pSnapshot);
+            release_snapshot(pPrototype);
+            pSnapshot   = NULL;
+            pPrototype  = NULL;
+
+            // Release interned values and default values
+            for (size_t i=0, n=vProperties.size(); i<n; ++i)
+            {
+                property_t *p   = vProperties.uget(i);
+                if (p->type != PT_STRING)
+                    continue;
+
+                release_string(p->v.sValue);
+                p->v.sValue     = StringPool::empty();
+
+                default_t *d    = (p->flags & F_DEFAULT) ? get_default(p->id) : NULL;
+                if (d != NULL)
+                {
+                    release_string(d->v.sValue);
+                    d->v.sValue     = StringPool::empty();
+                }
+            }
+
+            ++nVersion;
+            nFlags     &= ~S_PENDING;
+            pPrevLink   = NULL;
+            pNextLink   = NULL;
+            pSchema     = NULL;
+        }
+
+        void Style::empty_value(value_t *v, size_t type)
+        {
+            switch (type)
+            {
+                case PT_FLOAT:  v->fValue   = 0.0f;                 break;
+                case PT_BOOL:   v->bValue   = false;                break;
+                case PT_STRING: v->sValue   = StringPool::empty();  break;
+                default:        v->iValue   = 0;                    break;
+            }
+        }
+
+        bool Style::same_value(const value_t *a, const value_t *b, size_t type)
+        {
+            switch (type)
+            {
+                case PT_INT:    return a->iValue == b->iValue;
+                case PT_FLOAT:  return a->fValue == b->fValue;
+                case PT_BOOL:   return a->bValue == b->bValue;
+                case PT_STRING: return a->sValue == b->sValue; // Strings are interned
+                default:        break;
+            }
+            return true;
+        }
+
+        Style::default_t *Style::get_default(atom_t id)
+        {
+            for (size_t i=0, n=vDefaults.size(); i<n; ++i)
+            {
+                default_t *d    = vDefaults.uget(i);
+                if (d->id == id)
+                    return d;
+            }
+            return NULL;
+        }
+
+        void Style::get_default_value(value_t *dst, const property_t *p)
+        {
+            // Temporary properties are not owned by style, the default value matches the value
+            if (p->owner == NULL)
+            {
+                *dst    = p->v;
+                return;
+            }
+
+            // Lookup for the non-empty default value stored by the owner
+            if (p->flags & F_DEFAULT)
+            {
+                const default_t *d = p->owner->get_default(p->id);
+                if (d != NULL)
+                {
+                    *dst    = d->v;
+                    return;
+                }
+            }
+
+            empty_value(dst, p->type);
+        }
+
+        status_t Style::set_default_value(property_t *p, const value_t *dv)
+        {
+            // Empty default values are not stored
+            value_t empty;
+            empty_value(&empty, p->type);
+            if (same_value(dv, &empty, p->type))
+            {
+                drop_default_value(p);
+                return STATUS_OK;
+            }
+
+            // Allocate default value if needed
+            default_t *d    = (p->flags & F_DEFAULT) ? get_default(p->id) : NULL;
+            if (d == NULL)
+            {
+                if ((d = vDefaults.add()) == NULL)
+                    return STATUS_NO_MEM;
+                d->id           = p->id;
+                d->v            = empty;
+                p->flags       |= F_DEFAULT;
+            }
+
+            // Store the value
+            ++nVersion;
+            if (p->type == PT_STRING)
+            {
+                if (d->v.sValue != dv->sValue)
+                {
+                    const char *s   = acquire_string(dv->sValue);
+                    release_string(d->v.sValue);
+                    d->v.sValue     = s;
+                }
+            }
+            else
+                d->v            = *dv;
+
+            return STATUS_OK;
+        }
+
+        void Style::drop_default_value(property_t *p)
+        {
+            if (!(p->flags & F_DEFAULT))
+                return;
+
+            ++nVersion;
+            p->flags       &= ~F_DEFAULT;
+            default_t *d    = get_default(p->id);
+            if (d == NULL)
+                return;
+
+            if (p->type == PT_STRING)
+                release_string(d->v.sValue);
+            vDefaults.premove(d);
+        }
+
+        void Style::set_value(property_t *p, const value_t *v)
+        {
+            ++nVersion;
+            if (p->type == PT_STRING)
+            {
+                const char *s   = acquire_string(v->sValue);
+                release_string(p->v.sValue);
+                p->v.sValue     = s;
+            }
+            else
+                p->v            = *v;
+        }
+
         bool Style::config_mode() const
         {
             return (pSchema != NULL) ? pSchema->config_mode() : false;
@@ -150,198 +338,124 @@ namespace lsp
             return res;
         }
 
+        void Style::get_memory_stats(style_memory_stats_t *stats) const
+        {
+            ++stats->nStyles;
+            stats->nProperties     += vProperties.size();
+            stats->nDefaults       += vDefaults.size();
+            stats->nListeners      += vListeners.size();
+            stats->nStyleBytes     +=
+                sizeof(Style) +
+                vProperties.size() * sizeof(property_t) +
+                vDefaults.size() * sizeof(default_t) +
+                vListeners.size() * sizeof(listener_t) +
+                (vParents.size() + vChildren.size() + vLocks.size()) * sizeof(Style *);
+
+            if (sName != NULL)
+                stats->nStyleBytes     += strlen(sName) + 1;
+            if (sDflParents != NULL)
+                stats->nStyleBytes     += strlen(sDflParents) + 1;
+        }
+
         status_t Style::copy_property(property_t *dst, const property_t *src)
         {
             // Check type of property
             if (src->type != dst->type)
                 return STATUS_OK;
 
-            // Update contents
-            bool config = config_mode();
-
             switch (src->type)
             {
                 case PT_INT:
-                    if (dst->v.iValue != src->v.iValue)
-                    {
-                        ++dst->changes;
-                        dst->v.iValue   = src->v.iValue;
-                    }
-
-                    // Copy default value in INIT mode
-                    if ((config) && (dst->dv.iValue != src->dv.iValue))
-                    {
-                        ++dst->changes;
-                        dst->dv.iValue  = src->dv.iValue;
-                    }
-                    break;
                 case PT_FLOAT:
-                    if (dst->v.fValue != src->v.fValue)
-                    {
-                        ++dst->changes;
-                        dst->v.fValue   = src->v.fValue;
-                    }
-
-                    // Copy default value in INIT mode
-                    if ((config) && (dst->dv.fValue != src->dv.fValue))
-                    {
-                        ++dst->changes;
-                        dst->dv.fValue  = src->dv.fValue;
-                    }
-                    break;
                 case PT_BOOL:
-                    if (dst->v.bValue != src->v.bValue)
-                    {
-                        ++dst->changes;
-                        dst->v.bValue   = src->v.bValue;
-                    }
-
-                    // Copy default value in INIT mode
-                    if ((config) && (dst->dv.bValue != src->dv.bValue))
-                    {
-                        ++dst->changes;
-                        dst->dv.bValue  = src->dv.bValue;
-                    }
-                    break;
                 case PT_STRING:
-                {
-                    // Update value if it has changed
-                    if (::strcmp(dst->v.sValue, src->v.sValue) != 0)
-                    {
-                        char *tmp = ::strdup(src->v.sValue);
-                        if (tmp == NULL)
-                            return STATUS_NO_MEM;
-                        ::free(dst->v.sValue);
-                        dst->v.sValue   = tmp;
-                        ++dst->changes;
-                    }
-
-                    // Copy default value in INIT mode
-                    if ((config) && (::strcmp(dst->dv.sValue, src->dv.sValue) != 0))
-                    {
-                        char *tmp = ::strdup(src->dv.sValue);
-                        if (tmp == NULL)
-                            return STATUS_NO_MEM;
-                        ::free(dst->dv.sValue);
-                        dst->dv.sValue  = tmp;
-                        ++dst->changes;
-                    }
                     break;
-                }
                 default:
                     return STATUS_BAD_TYPE;
             }
 
-            return STATUS_OK;
-        }
-
-        Style::property_t *Style::create_property(atom_t id, const property_t *src, size_t flags)
-        {
-            // Allocate property
-            property_t *dst = vProperties.add();
-            if (dst == NULL)
-                return NULL;
+            // Update value if it has changed
+            if (!same_value(&dst->v, &src->v, src->type))
+            {
+                set_value(dst, &src->v);
+                ++dst->changes;
+            }
 
-            // Init contents
-            bool config = config_mode();
-            switch (src->type)
+            // Copy default value in INIT mode
+            if (config_mode())
             {
-                case PT_INT:
-                    dst->v.iValue   = src->v.iValue;
-                    dst->dv.iValue  = (config) ? src->dv.iValue : 0;
-                    break;
-                case PT_FLOAT:
-                    dst->v.fValue   = src->v.fValue;
-                    dst->dv.fValue  = (config) ? src->dv.fValue : 0.0f;
-                    break;
-                case PT_BOOL:
-                    dst->v.bValue   = src->v.bValue;
-                    dst->dv.bValue  = (config) ? src->dv.bValue : false;
-                    break;
-                case PT_STRING:
+                value_t sdv, ddv;
+                get_default_value(&sdv, src);
+                get_default_value(&ddv, dst);
+                if (!same_value(&ddv, &sdv, src->type))
                 {
-                    // Update value
-                    if ((dst->v.sValue = ::strdup(src->v.sValue)) == NULL)
-                    {
-                        vProperties.premove(dst);
-                        return NULL;
-                    }
-
-                    // Update default value
-                    const char *dv = (config) ? src->dv.sValue : "";
-                    if ((dst->dv.sValue = ::strdup(dv)) == NULL)
-                    {
-                        ::free(dst->v.sValue);
-                        dst->v.sValue   = NULL;
-                        vProperties.premove(dst);
-                        return NULL;
-                    }
-                    break;
+                    status_t res = set_default_value(dst, &sdv);
+                    if (res != STATUS_OK)
+                        return res;
+                    ++dst->changes;
                 }
-                default:
-                    return NULL;
             }
 
-            dst->id         = id;
-            dst->refs       = 0;
-            dst->type       = src->type;
-            dst->changes    = 0;
-            dst->flags      = flags;
-            dst->owner      = this;
-
-            return dst;
+            return STATUS_OK;
         }
 
-        Style::property_t *Style::create_property(atom_t id, property_type_t type, size_t flags)
+        Style::property_t *Style::add_property(atom_t id, size_t type, const value_t *v, const value_t *dv, size_t flags)
         {
-            // Allocate property
-            property_t *dst = vProperties.add();
-            if (dst == NULL)
-                return NULL;
-
-            // Init contents
             switch (type)
             {
                 case PT_INT:
-                    dst->v.iValue   = 0;
-                    dst->dv.iValue  = 0;
-                    break;
                 case PT_FLOAT:
-                    dst->v.fValue   = 0.0;
-                    dst->dv.fValue  = 0.0;
-                    break;
                 case PT_BOOL:
-                    dst->v.bValue   = false;
-                    dst->dv.bValue  = false;
-                    break;
                 case PT_STRING:
-                    if ((dst->v.sValue = ::strdup("")) == NULL)
-                    {
-                        vProperties.premove(dst);
-                        return NULL;
-                    }
-                    if ((dst->dv.sValue = ::strdup("")) == NULL)
-                    {
-                        ::free(dst->v.sValue);
-                        dst->v.sValue   = NULL;
-                        vProperties.premove(dst);
-                        return NULL;
-                    }
                     break;
                 default:
                     return NULL;
             }
 
+            // Allocate property
+            property_t *dst = vProperties.add();
+            if (dst == NULL)
+                return NULL;
+
+            // Init contents
+            dst->owner      = this;
             dst->id         = id;
             dst->refs       = 0;
-            dst->type       = type;
             dst->changes    = 0;
-            dst->flags      = flags;
-            dst->owner      = this;
+            dst->type       = type;
+            dst->flags      = flags & (~F_DEFAULT);
+            empty_value(&dst->v, type);
+            set_value(dst, v);
+
+            if (set_default_value(dst, dv) != STATUS_OK)
+            {
+                undef_property(dst);
+                vProperties.premove(dst);
+                return NULL;
+            }
 
             return dst;
         }
 
+        Style::property_t *Style::create_property(atom_t id, const property_t *src, size_t flags)
+        {
+            // Default value is inherited in INIT mode only
+            value_t dv;
+            if (config_mode())
+                get_default_value(&dv, src);
+            else
+                empty_value(&dv, src->type);
+
+            return add_property(id, src->type, &src->v, &dv, flags);
+        }
+
+        Style::property_t *Style::create_property(atom_t id, property_type_t type, size_t flags)
+        {
+            value_t v;
+            empty_value(&v, type);
+            return add_property(id, type, &v, &v, flags);
+        }
+
         status_t Style::sync_property(property_t *p)
         {
 //            lsp_trace("name = %s, flags=0x%x", atom_name(p->id), p->flags);
@@ -371,35 +485,20 @@ namespace lsp
             switch (p->type)
             {
                 case PT_INT:
-                    if (p->v.iValue == p->dv.iValue)
-                        return STATUS_OK;
-                    p->v.iValue = p->dv.iValue;
-                    break;
                 case PT_FLOAT:
-                    if (p->v.fValue == p->dv.fValue)
-                        return STATUS_OK;
-                    p->v.fValue = p->dv.fValue;
-                    break;
                 case PT_BOOL:
-                    if (p->v.bValue == p->dv.bValue)
-                        return STATUS_OK;
-                    p->v.bValue = p->dv.bValue;
-                    break;
                 case PT_STRING:
-                {
-                    if (::strcmp(p->v.sValue, p->dv.sValue) == 0)
-                        return STATUS_OK;
-                    char *tmp = ::strdup(p->dv.sValue);
-                    if (tmp == NULL)
-                        return STATUS_NO_MEM;
-                    ::free(p->v.sValue);
-                    p->v.sValue = tmp;
                     break;
-                }
                 default:
                     return STATUS_BAD_TYPE;
             }
 
+            value_t dv;
+            get_default_value(&dv, p);
+            if (same_value(&p->v, &dv, p->type))
+                return STATUS_OK;
+
+            set_value(p, &dv);
             ++p->changes;
             return STATUS_OK;
         }
@@ -596,8 +695,9 @@ namespace lsp
         {
             atom_t id = prop->id;
 
-            // Check whether we are in transactional state
-            if ((vLocks.size() > 0) && (prop->owner == this))
+            // Check whether we are in transactional state of the style or the whole schema
+            bool deferred = (prop->owner == this) && (pSchema != NULL) && (pSchema->in_transaction());
+            if (((vLocks.size() > 0) && (prop->owner == this)) || (deferred))
             {
                 size_t count = 0;
 
@@ -618,7 +718,11 @@ namespace lsp
 
                 // Are there any listeners pending?
                 if (count > 0)
+                {
                     prop->flags    |= F_NTF_LISTENERS;
+                    if ((deferred) && (vLocks.size() <= 0))
+                        pSchema->defer_notify(this);
+                }
             }
             else
             {
@@ -876,11 +980,17 @@ namespace lsp
             // Property has been found?
             if (p == NULL)
             {
-                // Lookup parent property
-                property_t *parent = get_parent_property(id);
+                // Lookup prototype or parent property
+                const snapshot_item_t *si = find_snapshot_item(pPrototype, id);
+                if ((si != NULL) && (si->nType == type))
+                    p = add_property(id, si->nType, &si->v, &si->dv, si->nFlags);
+                else
+                {
+                    property_t *parent = get_parent_property(id);
+                    p = (parent != NULL) ? create_property(id, parent, 0) : create_property(id, type, 0);
+                }
 
                 // Create property
-                p = (parent != NULL) ? create_property(id, parent, 0) : create_property(id, type, 0);
                 if (p == NULL)
                     return STATUS_NO_MEM;
 
@@ -1039,7 +1149,13 @@ namespace lsp
                 return STATUS_BAD_STATE;
 
             vLocks.pop();
-            if (n <= 0)
+            if (n > 0)
+                return STATUS_OK;
+
+            // Deliver notifications at the end of the schema transaction if it is active
+            if ((pSchema != NULL) && (pSchema->in_transaction()))
+                pSchema->defer_notify(this);
+            else
                 delayed_notify();
             return STATUS_OK;
         }
@@ -1231,7 +1347,7 @@ namespace lsp
         property_type_t Style::get_type(atom_t id) const
         {
             const property_t *prop = get_property_recursive(id);
-            return (prop != NULL) ? prop->type : PT_UNKNOWN;
+            return (prop != NULL) ? property_type_t(prop->type) : PT_UNKNOWN;
         }
 
         property_type_t Style::get_type(const char *id) const
@@ -1272,8 +1388,11 @@ namespace lsp
 
                 if (res == STATUS_OK)
                 {
-                    if (override_mode())
+                    if ((override_mode()) && (!(p->flags & F_OVERRIDDEN)))
+                    {
                         p->flags   |= F_OVERRIDDEN;
+                        ++nVersion;
+                    }
 
                     if (change != p->changes)
                     {
@@ -1289,9 +1408,10 @@ namespace lsp
         status_t Style::set_int(atom_t id, ssize_t value)
         {
             property_t tmp;
+            tmp.owner       = NULL;
             tmp.type        = PT_INT;
+            tmp.flags       = 0;
             tmp.v.iValue    = value;
-            tmp.dv.iValue   = value;
             return set_property(id, &tmp);
         }
 
@@ -1310,9 +1430,10 @@ namespace lsp
         status_t Style::set_float(atom_t id, float value)
         {
             property_t tmp;
+            tmp.owner       = NULL;
             tmp.type        = PT_FLOAT;
+            tmp.flags       = 0;
             tmp.v.fValue    = value;
-            tmp.dv.fValue   = value;
             return set_property(id, &tmp);
         }
 
@@ -1331,9 +1452,10 @@ namespace lsp
         status_t Style::set_bool(atom_t id, bool value)
         {
             property_t tmp;
+            tmp.owner       = NULL;
             tmp.type        = PT_BOOL;
+            tmp.flags       = 0;
             tmp.v.bValue    = value;
-            tmp.dv.bValue   = value;
             return set_property(id, &tmp);
         }
 
@@ -1354,11 +1476,7 @@ namespace lsp
             if (value == NULL)
                 return STATUS_BAD_ARGUMENTS;
 
-            property_t tmp;
-            tmp.type        = PT_STRING;
-            tmp.v.sValue    = const_cast<char *>(value->get_utf8());
-            tmp.dv.sValue   = tmp.v.sValue;
-            return set_property(id, &tmp);
+            return set_string(id, value->get_utf8());
         }
 
         status_t Style::set_string(const char *id, const LSPString *value)
@@ -1378,11 +1496,22 @@ namespace lsp
             if (value == NULL)
                 return STATUS_BAD_ARGUMENTS;
 
+            // Intern the string to make the temporary property compatible with the stored ones
+            StringPool *sp  = strings();
+            if (sp == NULL)
+                return STATUS_BAD_STATE;
+
             property_t tmp;
+            tmp.owner       = NULL;
             tmp.type        = PT_STRING;
-            tmp.v.sValue    = const_cast<char *>(value);
-            tmp.dv.sValue   = tmp.v.sValue;
-            return set_property(id, &tmp);
+            tmp.flags       = 0;
+            tmp.v.sValue    = sp->intern(value);
+            if (tmp.v.sValue == NULL)
+                return STATUS_NO_MEM;
+
+            status_t res    = set_property(id, &tmp);
+            sp->release(tmp.v.sValue);
+            return res;
         }
 
         status_t Style::set_string(const char *id, const char *value)
@@ -1407,6 +1536,7 @@ namespace lsp
 
             // Initialize property with default value
             p->flags   &= ~F_OVERRIDDEN;
+            ++nVersion;
             return sync_property(p);
         }
 
@@ -1422,71 +1552,31 @@ namespace lsp
             if (p->type != src->type)
                 return STATUS_BAD_TYPE;
 
-            // Override values
-            size_t changes  = p->changes;
             switch (p->type)
             {
                 case PT_INT:
-                    if ((!(p->flags & F_OVERRIDDEN)) &&
-                        (p->v.iValue != src->v.iValue))
-                    {
-
-                        p->v.iValue     = src->v.iValue;
-                        ++p->changes;
-                    }
-                    p->dv.iValue    = src->dv.iValue;
-                    break;
                 case PT_FLOAT:
-                    if ((!(p->flags & F_OVERRIDDEN)) &&
-                        (p->v.fValue != src->v.fValue))
-                    {
-
-                        p->v.fValue     = src->v.fValue;
-                        ++p->changes;
-                    }
-                    p->dv.fValue    = src->dv.fValue;
-                    break;
                 case PT_BOOL:
-                    if ((!(p->flags & F_OVERRIDDEN)) &&
-                        (p->v.bValue != src->v.bValue))
-                    {
-
-                        p->v.bValue     = src->v.bValue;
-                        ++p->changes;
-                    }
-                    p->dv.bValue    = src->dv.bValue;
-                    break;
                 case PT_STRING:
-                {
-                    // Allocate strings
-                    char *ds = ::strdup(src->dv.sValue);
-                    if (ds == NULL)
-                        return STATUS_NO_MEM;
-
-                    // Need to override values?
-                    if ((!(p->flags & F_OVERRIDDEN)) &&
-                        (::strcmp(p->v.sValue, src->v.sValue) != 0))
-                    {
-                        char *s         = ::strdup(src->v.sValue);
-                        if (s == NULL)
-                        {
-                            ::free(ds);
-                            return STATUS_NO_MEM;
-                        }
-
-                        ::free(p->v.sValue);
-                        p->v.sValue     = s;
-                        ++p->changes;
-                    }
-
-                    ::free(p->dv.sValue);
-                    p->dv.sValue    = ds;
                     break;
-                }
                 default:
                     return STATUS_UNKNOWN_ERR;
             }
 
+            // Override values
+            size_t changes  = p->changes;
+            if ((!(p->flags & F_OVERRIDDEN)) && (!same_value(&p->v, &src->v, p->type)))
+            {
+                set_value(p, &src->v);
+                ++p->changes;
+            }
+
+            value_t dv;
+            get_default_value(&dv, src);
+            status_t res    = set_default_value(p, &dv);
+            if (res != STATUS_OK)
+                return res;
+
             if (changes != p->changes)
             {
                 notify_listeners(p);
@@ -1547,6 +1637,142 @@ namespace lsp
             return STATUS_OK;
         }
 
+        Style::snapshot_t *Style::get_snapshot()
+        {
+            // Re-use the snapshot if the style did not change
+            if ((pSnapshot != NULL) && (pSnapshot->nVersion == nVersion))
+                return pSnapshot;
+
+            release_snapshot(pSnapshot);
+            pSnapshot       = NULL;
+
+            // Snapshots can not be taken without the string pool
+            if (pSchema == NULL)
+                return NULL;
+
+            snapshot_t *snap    = new snapshot_t;
+            if (snap == NULL)
+                return NULL;
+            snap->nRefs         = 1;
+            snap->nVersion      = nVersion;
+            snap->pStrings      = strings();
+            snap->nListeners    = vListeners.size();
+
+            if (!snap->vItems.reserve(vProperties.size()))
+            {
+                release_snapshot(snap);
+                return NULL;
+            }
+
+            // Copy properties, keep them sorted by identifier
+            for (size_t i=0, n=vProperties.size(); i<n; ++i)
+            {
+                const property_t *p = vProperties.uget(i);
+                if ((p == NULL) || (p->type == PT_UNKNOWN))
+                    continue;
+
+                size_t first = 0, last = snap->vItems.size();
+                while (first < last)
+                {
+                    size_t mid = (first + last) >> 1;
+                    if (snap->vItems.uget(mid)->nId < p->id)
+                        first       = mid + 1;
+                    else
+                        last        = mid;
+                }
+
+                snapshot_item_t *si = snap->vItems.insert_n(first, 1);
+                if (si == NULL)
+                {
+                    release_snapshot(snap);
+                    return NULL;
+                }
+
+                si->nId         = p->id;
+                si->nType       = p->type;
+                si->nFlags      = p->flags & F_OVERRIDDEN;
+                si->v           = p->v;
+                get_default_value(&si->dv, p);
+                if (p->type == PT_STRING)
+                {
+                    si->v.sValue    = snap->pStrings->acquire(si->v.sValue);
+                    si->dv.sValue   = snap->pStrings->acquire(si->dv.sValue);
+                }
+            }
+
+            pSnapshot       = snap;
+            return snap;
+        }
+
+        void Style::release_snapshot(snapshot_t *snapshot)
+        {
+            if ((snapshot == NULL) || ((--snapshot->nRefs) > 0))
+                return;
+
+            for (size_t i=0, n=snapshot->vItems.size(); i<n; ++i)
+            {
+                snapshot_item_t *si = snapshot->vItems.uget(i);
+                if (si->nType != PT_STRING)
+                    continue;
+                snapshot->pStrings->release(si->v.sValue);
+                snapshot->pStrings->release(si->dv.sValue);
+            }
+            snapshot->vItems.flush();
+
+            delete snapshot;
+        }
+
+        const Style::snapshot_item_t *Style::find_snapshot_item(const snapshot_t *snapshot, atom_t id)
+        {
+            if (snapshot == NULL)
+                return NULL;
+
+            ssize_t first = 0, last = ssize_t(snapshot->vItems.size()) - 1;
+            while (first <= last)
+            {
+                ssize_t mid = (first + last) >> 1;
+                const snapshot_item_t *si = snapshot->vItems.uget(mid);
+                if (si->nId == id)
+                    return si;
+                else if (si->nId < id)
+                    first       = mid + 1;
+                else
+                    last        = mid - 1;
+            }
+
+            return NULL;
+        }
+
+        status_t Style::set_prototype(Style *proto)
+        {
+            if (proto == this)
+                return STATUS_BAD_ARGUMENTS;
+
+            release_snapshot(pPrototype);
+            pPrototype      = NULL;
+            if (proto == NULL)
+                return STATUS_OK;
+            if (pSchema == NULL)
+                return STATUS_BAD_STATE;
+            if (proto->pSchema != pSchema)
+                return STATUS_BAD_ARGUMENTS;
+
+            snapshot_t *snap    = proto->get_snapshot();
+            if (snap == NULL)
+                return STATUS_NO_MEM;
+
+            // Reserve space for properties and listener bindings to avoid re-allocations
+            if (!vProperties.reserve(vProperties.size() + snap->vItems.size()))
+                return STATUS_NO_MEM;
+            if (!vListeners.reserve(vListeners.size() + snap->nListeners))
+                return STATUS_NO_MEM;
+
+            ++snap->nRefs;
+            pPrototype      = snap;
+
+            return STATUS_OK;
+        }
+
         status_t Style::set_default_parents(const LSPString *parents)
         {
             return set_default_parents((parents != NULL) ? parents->get_utf8() : NULL);
@@ -30,6 +30,7 @@ namespace lsp
     {
         StyleSheet::style_t::style_t()
         {
+            waiting     = 0;
         }
 
         StyleSheet::style_t::~style_t()
@@ -63,6 +64,11 @@ namespace lsp
         }
 
         StyleSheet::~StyleSheet()
+        {
+            do_destroy();
+        }
+
+        void StyleSheet::do_destroy()
         {
             // Delete root style
             if (pRoot != NULL)
@@ -84,6 +90,7 @@ namespace lsp
             vc.flush();
 
             // Delete styles
+            vOrder.flush();
             lltl::parray<style_t> vs;
             vStyles.values(&vs);
             vStyles.flush();
@@ -120,6 +127,147 @@ namespace lsp
             vv.flush();
         }
 
+        StyleSheet::style_t *StyleSheet::copy_style(const style_t *src)
+        {
+            style_t *dst = new style_t();
+            if (dst == NULL)
+                return NULL;
+
+            bool ok = dst->name.set(&src->name);
+
+            // Copy parents
+            for (size_t i=0, n=src->parents.size(); (ok) && (i<n); ++i)
+            {
+                const LSPString *name = src->parents.uget(i);
+                LSPString *xname = (name != NULL) ? name->clone() : NULL;
+                if ((xname == NULL) || (!dst->parents.add(xname)))
+                {
+                    if (xname != NULL)
+                        delete xname;
+                    ok = false;
+                }
+            }
+
+            // Copy properties
+            lltl::parray<LSPString> vk;
+            ok = ok && src->properties.keys(&vk);
+            for (size_t i=0, n=vk.size(); (ok) && (i<n); ++i)
+            {
+                const LSPString *key    = vk.uget(i);
+                const LSPString *value  = src->properties.get(key);
+                LSPString *xvalue       = (value != NULL) ? value->clone() : NULL;
+                if ((xvalue == NULL) || (!dst->properties.create(key, xvalue)))
+                {
+                    if (xvalue != NULL)
+                        delete xvalue;
+                    ok = false;
+                }
+            }
+
+            if (!ok)
+            {
+                delete dst;
+                return NULL;
+            }
+
+            return dst;
+        }
+
+        status_t StyleSheet::copy(const StyleSheet *src)
+        {
+            if (src == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            if (src == this)
+                return STATUS_OK;
+
+            do_destroy();
+            sError.clear();
+            if (!sTitle.set(&src->sTitle))
+                return STATUS_NO_MEM;
+
+            // Copy root style
+            if (src->pRoot != NULL)
+            {
+                if ((pRoot = copy_style(src->pRoot)) == NULL)
+                    return STATUS_NO_MEM;
+            }
+
+            // Copy styles
+            lltl::parray<LSPString> vk;
+            if (!src->vStyles.keys(&vk))
+                return STATUS_NO_MEM;
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                const LSPString *key    = vk.uget(i);
+                style_t *s              = copy_style(src->vStyles.get(key));
+                if (s == NULL)
+                    return STATUS_NO_MEM;
+                if (!vStyles.create(key, s))
+                {
+                    delete s;
+                    return STATUS_NO_MEM;
+                }
+            }
+
+            // Copy fonts
+            vk.clear();
+            if (!src->vFonts.keys(&vk))
+                return STATUS_NO_MEM;
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                const LSPString *key    = vk.uget(i);
+                const font_t *sf        = src->vFonts.get(key);
+                font_t *f               = new font_t();
+                if (f == NULL)
+                    return STATUS_NO_MEM;
+                f->alias                = sf->alias;
+                if ((!f->name.set(&sf->name)) ||
+                    (!f->path.set(&sf->path)) ||
+                    (!vFonts.create(key, f)))
+                {
+                    delete f;
+                    return STATUS_NO_MEM;
+                }
+            }
+
+            // Copy colors
+            vk.clear();
+            if (!src->vColors.keys(&vk))
+                return STATUS_NO_MEM;
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                const LSPString *key    = vk.uget(i);
+                lsp::Color *c           = new lsp::Color(src->vColors.get(key));
+                if (c == NULL)
+                    return STATUS_NO_MEM;
+                if (!vColors.create(key, c))
+                {
+                    delete c;
+                    return STATUS_NO_MEM;
+                }
+            }
+
+            // Copy constants
+            vk.clear();
+            if (!src->vConstants.keys(&vk))
+                return STATUS_NO_MEM;
+            for (size_t i=0, n=vk.size(); i<n; ++i)
+            {
+                const LSPString *key    = vk.uget(i);
+                LSPString *value        = src->vConstants.get(key)->clone();
+                if (value == NULL)
+                    return STATUS_NO_MEM;
+                if (!vConstants.create(key, value))
+                {
+                    delete value;
+                    return STATUS_NO_MEM;
+                }
+            }
+
+            // Compute the order of styles
+            return validate();
+        }
+
         status_t StyleSheet::parse_document(xml::PullParser *p)
         {
             status_t item, res = STATUS_OK;
@@ -1311,6 +1459,8 @@ namespace lsp
 
         status_t StyleSheet::validate()
         {
+            vOrder.clear();
+
             if (pRoot != NULL)
             {
                 if (!pRoot->parents.is_empty())
@@ -1324,121 +1474,80 @@ namespace lsp
             if (!vStyles.values(&vs))
                 return STATUS_NO_MEM;
 
-            for (size_t i=0, n=vs.size(); i<n; ++i)
-            {
-                // Add style to the path
-                style_t *s = vs.uget(i);
-                status_t res = validate_style(s);
-                if (res != STATUS_OK)
-                    return res;
-            }
+            status_t res = order_styles(&vs);
 
-            return STATUS_OK;
-        }
+            // Drop temporary data
+            for (size_t i=0, n=vs.size(); i<n; ++i)
+                vs.uget(i)->children.flush();
+            if (res != STATUS_OK)
+                vOrder.clear();
 
-        void StyleSheet::drop_paths(lltl::parray<path_t> *paths)
-        {
-            for (size_t i=0, n=paths->size(); i<n; ++i)
-            {
-                path_t *p = paths->uget(i);
-                if (p != NULL)
-                    delete p;
-            }
-            paths->flush();
+            return res;
         }
 
-        status_t StyleSheet::validate_style(style_t *s)
+        status_t StyleSheet::order_styles(lltl::parray<style_t> *vs)
         {
-            lltl::parray<path_t> stack;
-            path_t *p = new path_t();
-            if (p == NULL)
-                return STATUS_NO_MEM;
-            else if (!stack.push(p))
+            // Build the list of children and count parents for each style
+            for (size_t i=0, n=vs->size(); i<n; ++i)
             {
-                delete p;
-                return STATUS_NO_MEM;
+                style_t *s      = vs->uget(i);
+                s->waiting      = 0;
+                s->children.clear();
             }
-            p->curr = s;
 
-            while (!stack.is_empty())
+            for (size_t i=0, n=vs->size(); i<n; ++i)
             {
-                // Get current path
-                p = stack.pop();
-                if (p == NULL)
-                {
-                    drop_paths(&stack);
-                    return STATUS_UNKNOWN_ERR;
-                }
-
-                // There is nothing to check?
-                s = p->curr;
-                if (s->parents.is_empty())
-                {
-                    delete p;
-                    continue;
-                }
-
-                // Add current style to list of visited
-                if (!p->visited.add(s))
+                style_t *s      = vs->uget(i);
+                for (size_t j=0, m=s->parents.size(); j<m; ++j)
                 {
-                    delete p;
-                    drop_paths(&stack);
-                    return STATUS_NO_MEM;
-                }
-
-//                lsp_trace("Curr: %p (%s)", s, s->name.get_utf8());
-//                for (size_t i=0, n=p->visited.size(); i<n; ++i)
-//                {
-//                    style_t *xp = p->visited.uget(i);
-//                    lsp_trace("  visited: %p (%s)", xp, xp->name.get_utf8());
-//                }
-
-                for (size_t i=0, n=s->parents.size(); i<n; )
-                {
-                    // Obtain the parent style
-                    LSPString *name = s->parents.uget(i++);
+                    LSPString *name = s->parents.uget(j);
                     style_t *ps = ((name == NULL) || (name->equals_ascii("root"))) ? pRoot : vStyles.get(name);
-
-//                    lsp_trace("  testing: %p (%s), i=%d, n=%d", ps, (ps != NULL) ? ps->name.get_utf8() : "???", int(i), int(n));
-                    if ((ps == NULL) || (p->visited.contains(ps)))
+                    if (ps == NULL)
                     {
                         sError.fmt_utf8("Unexisting style found in tree: '%s'", (name != NULL) ? name->get_utf8() : "root");
-                        delete p;
-                        drop_paths(&stack);
                         return STATUS_BAD_HIERARCHY;
                     }
+                    if (ps == pRoot)
+                        continue;
 
-                    // Check next step
-                    path_t *np = p;
-                    if (i < n)
-                    {
-                        np = new path_t();
-                        if (np == NULL)
-                        {
-                            drop_paths(&stack);
-                            delete p;
-                            return STATUS_NO_MEM;
-                        }
+                    if (!ps->children.add(s))
+                        return STATUS_NO_MEM;
+                    ++s->waiting;
+                }
+            }
 
-                        if (!np->visited.add(p->visited)) // Copy list of visited
-                        {
-                            delete np;
-                            delete p;
-                            drop_paths(&stack);
-                            return STATUS_NO_MEM;
-                        }
-                    }
+            // Emit styles which have all parents emitted (Kahn's algorithm)
+            for (size_t i=0, n=vs->size(); i<n; ++i)
+            {
+                style_t *s      = vs->uget(i);
+                if ((s->waiting == 0) && (!vOrder.add(s)))
+                    return STATUS_NO_MEM;
+            }
 
-                    np->curr    = ps;
+            for (size_t i=0; i<vOrder.size(); ++i)
+            {
+                style_t *s      = vOrder.uget(i);
+                for (size_t j=0, m=s->children.size(); j<m; ++j)
+                {
+                    style_t *cs     = s->children.uget(j);
+                    if ((--cs->waiting == 0) && (!vOrder.add(cs)))
+                        return STATUS_NO_MEM;
+                }
+            }
 
-                    // Add path to stack
-                    if (!stack.push(np))
+            // All styles that have not been emitted belong to the inheritance loop or depend on it
+            if (vOrder.size() < vs->size())
+            {
+                for (size_t i=0, n=vs->size(); i<n; ++i)
+                {
+                    style_t *s      = vs->uget(i);
+                    if (s->waiting > 0)
                     {
-                        delete np;
-                        drop_paths(&stack);
-                        return STATUS_NO_MEM;
+                        sError.fmt_utf8("Inheritance loop detected for style '%s'", s->name.get_utf8());
+                        break;
                     }
                 }
+                return STATUS_BAD_HIERARCHY;
             }
 
             return STATUS_OK;
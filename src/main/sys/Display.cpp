@@ -24,24 +24,30 @@
 #include <lsp-plug.in/ws/factory.h>
 #include <lsp-plug.in/i18n/Dictionary.h>
 #include <private/tk/style/BuiltinStyle.h>
+#include <private/tk/sys/HeadlessDisplay.h>
 
 namespace lsp
 {
     namespace tk
     {
         Display::Display(display_settings_t *settings):
-            sSchema(this, this)
+            sSchema(this, this),
+            sFrameScheduler(this),
+            sWindowPool(this),
+            sTimerWheel(this)
         {
             pDictionary     = NULL;
             pDisplay        = NULL;
             pResourceLoader = NULL;
             pEnv            = NULL;
+            bHeadless       = false;
 
             // Apply custom settings
             if (settings != NULL)
             {
                 pResourceLoader     = settings->resources;
                 pEnv                = (settings->environment != NULL) ? settings->environment->clone() : NULL;
+                bHeadless           = settings->headless;
             }
         }
 
@@ -77,6 +83,13 @@ namespace lsp
             }
             sWidgets.flush();
 
+            // Stop rendering and destroy all pooled surfaces before the native display
+            sFrameScheduler.destroy();
+            sTimerWheel.destroy();
+            sWindowPool.destroy();
+            sSurfacePool.destroy();
+            sStringCache.destroy();
+
             // Execute slot
             sSlots.execute(SLOT_DESTROY, NULL);
             sSlots.destroy();
@@ -84,7 +97,13 @@ namespace lsp
             // Destroy display
             if (pDisplay != NULL)
             {
-                ws::free_display(pDisplay);
+                if (bHeadless)
+                {
+                    pDisplay->destroy();
+                    delete pDisplay;
+                }
+                else
+                    ws::free_display(pDisplay);
                 pDisplay = NULL;
             }
 
@@ -151,6 +170,9 @@ namespace lsp
 
         status_t Display::init(int argc, const char **argv)
         {
+            if (bHeadless)
+                return init_headless(argc, argv);
+
             // Create display
             ws::IDisplay *dpy = ws::create_display(argc, argv);
             if (dpy == NULL)
@@ -170,6 +192,50 @@ namespace lsp
             return res;
         }
 
+        status_t Display::load_dictionary()
+        {
+            LSPString dict_base;
+            const char *env_dict_base = pEnv->get_utf8(LSP_TK_ENV_DICT_PATH, LSP_TK_ENV_DICT_PATH_DFL);
+            if (!dict_base.set_utf8(env_dict_base))
+                return STATUS_NO_MEM;
+
+            // Templates resolved from the previous contents of the dictionary are not valid anymore
+            status_t res = pDictionary->init(&dict_base);
+            sStringCache.invalidate();
+
+            return res;
+        }
+
+        status_t Display::reload_dictionary()
+        {
+            if ((pDictionary == NULL) || (pEnv == NULL))
+                return STATUS_BAD_STATE;
+
+            return load_dictionary();
+        }
+
+        status_t Display::init_headless(int argc, const char **argv)
+        {
+            // Create display
+            HeadlessDisplay *dpy = new HeadlessDisplay();
+            if (dpy == NULL)
+                return STATUS_NO_MEM;
+
+            status_t res = dpy->init(argc, argv);
+            if ((res == STATUS_OK) && (!sSlots.add(tk::SLOT_IDLE)))
+                res = STATUS_NO_MEM;
+            if (res == STATUS_OK)
+                res = init(dpy, argc, argv);
+
+            if (res != STATUS_OK)
+            {
+                dpy->destroy();
+                delete dpy;
+            }
+
+            return res;
+        }
+
         status_t Display::init(ws::IDisplay *dpy, int argc, const char **argv)
         {
             // Should be non-null
@@ -182,18 +248,12 @@ namespace lsp
             if (pEnv == NULL)
                 return STATUS_NO_MEM;
 
-            // Initialize dictionary
-            LSPString dict_base;
-            const char *env_dict_base = pEnv->get_utf8(LSP_TK_ENV_DICT_PATH, LSP_TK_ENV_DICT_PATH_DFL);
-            if (!dict_base.set_utf8(env_dict_base))
-                return STATUS_NO_MEM;
-
             // Initialize dictionary
             pDictionary  = new i18n::Dictionary(pResourceLoader);
             if (pDictionary == NULL)
                 return STATUS_NO_MEM;
 
-            status_t res = pDictionary->init(&dict_base);
+            status_t res = load_dictionary();
             if (res != STATUS_OK)
                 return res;
 
@@ -216,6 +276,9 @@ namespace lsp
             // Remember the display handle
             dpy->set_main_callback(main_task_handler, this);
 
+            // Create native windows for popups in advance, the failure is not critical
+            sWindowPool.prewarm();
+
             return STATUS_OK;
         }
 
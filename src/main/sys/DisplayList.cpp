@@ -0,0 +1,337 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        DisplayList::DisplayList()
+        {
+        }
+
+        DisplayList::~DisplayList()
+        {
+            destroy();
+        }
+
+        void DisplayList::destroy()
+        {
+            vCommands.flush();
+            vGradients.flush();
+            vStops.flush();
+            vPoints.flush();
+        }
+
+        void DisplayList::clear()
+        {
+            vCommands.clear();
+            vGradients.clear();
+            vStops.clear();
+            vPoints.clear();
+        }
+
+        DisplayList::command_t *DisplayList::add_command(size_t type, ssize_t gradient)
+        {
+            command_t *cmd      = vCommands.add();
+            if (cmd == NULL)
+                return NULL;
+
+            cmd->nType          = type;
+            cmd->nGradient      = gradient;
+            cmd->nFirst         = 0;
+            cmd->nPoints        = 0;
+            cmd->bFlag          = false;
+
+            return cmd;
+        }
+
+        ssize_t DisplayList::add_gradient(size_t type, float a0, float a1, float a2, float a3, float a4)
+        {
+            gradient_t *g       = vGradients.add();
+            if (g == NULL)
+                return -STATUS_NO_MEM;
+
+            g->nType            = type;
+            g->vArgs[0]         = a0;
+            g->vArgs[1]         = a1;
+            g->vArgs[2]         = a2;
+            g->vArgs[3]         = a3;
+            g->vArgs[4]         = a4;
+            g->nFirst           = vStops.size();
+            g->nStops           = 0;
+
+            return vGradients.size() - 1;
+        }
+
+        ssize_t DisplayList::linear_gradient(float x0, float y0, float x1, float y1)
+        {
+            return add_gradient(GR_LINEAR, x0, y0, x1, y1, 0.0f);
+        }
+
+        ssize_t DisplayList::radial_gradient(float cx0, float cy0, float cx1, float cy1, float r)
+        {
+            return add_gradient(GR_RADIAL, cx0, cy0, cx1, cy1, r);
+        }
+
+        void DisplayList::add_color(ssize_t gradient, float offset, const lsp::Color &c)
+        {
+            add_color(gradient, offset, c, c.alpha());
+        }
+
+        void DisplayList::add_color(ssize_t gradient, float offset, const lsp::Color &c, float a)
+        {
+            gradient_t *g       = (gradient >= 0) ? vGradients.get(gradient) : NULL;
+            if (g == NULL)
+                return;
+
+            // Color stops of the gradient should be stored sequentially
+            if (g->nFirst + g->nStops != vStops.size())
+                return;
+
+            stop_t *st          = vStops.add();
+            if (st == NULL)
+                return;
+
+            st->fOffset         = offset;
+            st->fAlpha          = a;
+            st->sColor          = c;
+            ++g->nStops;
+        }
+
+        void DisplayList::set_antialiasing(bool set)
+        {
+            command_t *cmd      = add_command(CMD_ANTIALIASING, -1);
+            if (cmd != NULL)
+                cmd->bFlag          = set;
+        }
+
+        void DisplayList::line(const lsp::Color &c, float x0, float y0, float x1, float y1, float width)
+        {
+            command_t *cmd      = add_command(CMD_LINE, -1);
+            if (cmd == NULL)
+                return;
+
+            cmd->vArgs[0]       = x0;
+            cmd->vArgs[1]       = y0;
+            cmd->vArgs[2]       = x1;
+            cmd->vArgs[3]       = y1;
+            cmd->vArgs[4]       = width;
+            cmd->sColor         = c;
+        }
+
+        void DisplayList::parametric_line(const lsp::Color &color, float a, float b, float c,
+            ssize_t left, ssize_t right, ssize_t bottom, ssize_t top, float width)
+        {
+            command_t *cmd      = add_command(CMD_PARAMETRIC_LINE, -1);
+            if (cmd == NULL)
+                return;
+
+            cmd->vArgs[0]       = a;
+            cmd->vArgs[1]       = b;
+            cmd->vArgs[2]       = c;
+            cmd->vArgs[3]       = left;
+            cmd->vArgs[4]       = right;
+            cmd->vArgs[5]       = bottom;
+            cmd->vArgs[6]       = top;
+            cmd->vArgs[7]       = width;
+            cmd->sColor         = color;
+        }
+
+        void DisplayList::parametric_bar(ssize_t gradient,
+            float a1, float b1, float c1, float a2, float b2, float c2,
+            ssize_t left, ssize_t right, ssize_t bottom, ssize_t top)
+        {
+            if (gradient < 0)
+                return;
+            command_t *cmd      = add_command(CMD_PARAMETRIC_BAR, gradient);
+            if (cmd == NULL)
+                return;
+
+            cmd->vArgs[0]       = a1;
+            cmd->vArgs[1]       = b1;
+            cmd->vArgs[2]       = c1;
+            cmd->vArgs[3]       = a2;
+            cmd->vArgs[4]       = b2;
+            cmd->vArgs[5]       = c2;
+            cmd->vArgs[6]       = left;
+            cmd->vArgs[7]       = right;
+            cmd->vArgs[8]       = bottom;
+            cmd->vArgs[9]       = top;
+        }
+
+        void DisplayList::fill_circle(const lsp::Color &c, float x, float y, float r)
+        {
+            command_t *cmd      = add_command(CMD_FILL_CIRCLE, -1);
+            if (cmd == NULL)
+                return;
+
+            cmd->vArgs[0]       = x;
+            cmd->vArgs[1]       = y;
+            cmd->vArgs[2]       = r;
+            cmd->sColor         = c;
+        }
+
+        void DisplayList::fill_circle(ssize_t gradient, float x, float y, float r)
+        {
+            if (gradient < 0)
+                return;
+            command_t *cmd      = add_command(CMD_FILL_CIRCLE, gradient);
+            if (cmd == NULL)
+                return;
+
+            cmd->vArgs[0]       = x;
+            cmd->vArgs[1]       = y;
+            cmd->vArgs[2]       = r;
+        }
+
+        void DisplayList::fill_poly(ssize_t gradient, const float *x, const float *y, size_t n)
+        {
+            if ((gradient < 0) || (n <= 0))
+                return;
+
+            // Store coordinates
+            size_t first        = vPoints.size();
+            float *dst          = vPoints.append_n(n * 2);
+            if (dst == NULL)
+                return;
+            memcpy(dst, x, n * sizeof(float));
+            memcpy(&dst[n], y, n * sizeof(float));
+
+            command_t *cmd      = add_command(CMD_FILL_POLY, gradient);
+            if (cmd == NULL)
+                return;
+
+            cmd->nFirst         = first;
+            cmd->nPoints        = n;
+        }
+
+        ws::IGradient *DisplayList::create_gradient(ws::ISurface *s, ssize_t index) const
+        {
+            const gradient_t *g = vGradients.get(index);
+            if (g == NULL)
+                return NULL;
+
+            ws::IGradient *gr   = (g->nType == GR_RADIAL) ?
+                s->radial_gradient(g->vArgs[0], g->vArgs[1], g->vArgs[2], g->vArgs[3], g->vArgs[4]) :
+                s->linear_gradient(g->vArgs[0], g->vArgs[1], g->vArgs[2], g->vArgs[3]);
+            if (gr == NULL)
+                return NULL;
+
+            for (size_t i=0; i<g->nStops; ++i)
+            {
+                const stop_t *st    = vStops.uget(g->nFirst + i);
+                gr->add_color(st->fOffset, st->sColor, st->fAlpha);
+            }
+
+            return gr;
+        }
+
+        void DisplayList::replay(ws::ISurface *s) const
+        {
+            bool aa_saved       = false;
+            bool aa             = false;
+
+            for (size_t i=0, n=vCommands.size(); i<n; ++i)
+            {
+                const command_t *cmd    = vCommands.uget(i);
+                const float *v          = cmd->vArgs;
+
+                switch (cmd->nType)
+                {
+                    case CMD_ANTIALIASING:
+                    {
+                        bool old            = s->set_antialiasing(cmd->bFlag);
+                        if (!aa_saved)
+                        {
+                            aa                  = old;
+                            aa_saved            = true;
+                        }
+                        break;
+                    }
+
+                    case CMD_LINE:
+                        s->line(cmd->sColor, v[0], v[1], v[2], v[3], v[4]);
+                        break;
+
+                    case CMD_PARAMETRIC_LINE:
+                        s->parametric_line(
+                            cmd->sColor,
+                            v[0], v[1], v[2],
+                            ssize_t(v[3]), ssize_t(v[4]), ssize_t(v[5]), ssize_t(v[6]),
+                            v[7]);
+                        break;
+
+                    case CMD_PARAMETRIC_BAR:
+                    {
+                        ws::IGradient *g    = create_gradient(s, cmd->nGradient);
+                        if (g == NULL)
+                            break;
+                        s->parametric_bar(
+                            g,
+                            v[0], v[1], v[2], v[3], v[4], v[5],
+                            ssize_t(v[6]), ssize_t(v[7]), ssize_t(v[8]), ssize_t(v[9]));
+                        delete g;
+                        break;
+                    }
+
+                    case CMD_FILL_CIRCLE:
+                    {
+                        if (cmd->nGradient < 0)
+                        {
+                            s->fill_circle(cmd->sColor, v[0], v[1], v[2]);
+                            break;
+                        }
+
+                        ws::IGradient *g    = create_gradient(s, cmd->nGradient);
+                        if (g == NULL)
+                            break;
+                        s->fill_circle(g, v[0], v[1], v[2]);
+                        delete g;
+                        break;
+                    }
+
+                    case CMD_FILL_POLY:
+                    {
+                        ws::IGradient *g    = create_gradient(s, cmd->nGradient);
+                        if (g == NULL)
+                            break;
+                        const float *x      = vPoints.uget(cmd->nFirst);
+                        s->fill_poly(g, x, &x[cmd->nPoints], cmd->nPoints);
+                        delete g;
+                        break;
+                    }
+
+                    default:
+                        break;
+                }
+            }
+
+            // Restore the anti-aliasing mode of the surface
+            if (aa_saved)
+                s->set_antialiasing(aa);
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
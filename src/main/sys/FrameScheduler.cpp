@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/runtime/system.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        static constexpr ws::timestamp_t FPS_PERIOD     = 1000;
+
+        FrameScheduler::FrameScheduler(Display *dpy)
+        {
+            pDisplay        = dpy;
+            nTaskID         = -1;
+            nLastFrame      = 0;
+            nMinInterval    = 0;
+            nMaxInterval    = 1000.0f / LSP_TK_FRAME_RATE_MIN;
+            nInterval       = 0;
+            fRenderTime     = 0.0f;
+            bAnimation      = false;
+            bSkipped        = false;
+            bTicking        = false;
+
+            nFpsStart       = 0;
+            nFpsFrames      = 0;
+            fAchievedFPS    = 0.0f;
+            nRequests       = 0;
+            nFrames         = 0;
+            nSkippedFrames  = 0;
+            nIdle           = 0;
+
+            set_frame_rate(LSP_TK_FRAME_RATE_DEFAULT);
+        }
+
+        FrameScheduler::~FrameScheduler()
+        {
+            destroy();
+        }
+
+        void FrameScheduler::destroy()
+        {
+            if (nTaskID >= 0)
+            {
+                ws::IDisplay *dpy   = (pDisplay != NULL) ? pDisplay->display() : NULL;
+                if (dpy != NULL)
+                    dpy->cancel_task(nTaskID);
+                nTaskID         = -1;
+            }
+
+            vWindows.flush();
+        }
+
+        status_t FrameScheduler::add(Window *wnd)
+        {
+            if (wnd == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            if (vWindows.contains(wnd))
+                return STATUS_OK;
+            if (!vWindows.add(wnd))
+                return STATUS_NO_MEM;
+
+            request_frame();
+            return STATUS_OK;
+        }
+
+        void FrameScheduler::remove(Window *wnd)
+        {
+            if (!vWindows.premove(wnd))
+                return;
+            if ((vWindows.size() > 0) || (nTaskID < 0))
+                return;
+
+            // Nothing to render any more
+            ws::IDisplay *dpy   = (pDisplay != NULL) ? pDisplay->display() : NULL;
+            if (dpy != NULL)
+                dpy->cancel_task(nTaskID);
+            nTaskID         = -1;
+        }
+
+        void FrameScheduler::schedule(ws::timestamp_t time)
+        {
+            if ((nTaskID >= 0) || (bTicking) || (vWindows.is_empty()))
+                return;
+
+            ws::IDisplay *dpy   = (pDisplay != NULL) ? pDisplay->display() : NULL;
+            if (dpy == NULL)
+                return;
+
+            ws::taskid_t id     = dpy->submit_task(time, tick_handler, this);
+            if (id >= 0)
+                nTaskID             = id;
+        }
+
+        void FrameScheduler::request_frame()
+        {
+            ++nRequests;
+            if ((nTaskID >= 0) || (bTicking))
+                return;
+
+            // Do not render frames more often than allowed by the current interval
+            ws::timestamp_t time    = system::get_time_millis();
+            schedule(lsp_max(time, nLastFrame + nInterval));
+        }
+
+        void FrameScheduler::request_animation()
+        {
+            bAnimation      = true;
+            request_frame();
+        }
+
+        float FrameScheduler::frame_rate() const
+        {
+            return 1000.0f / nMinInterval;
+        }
+
+        void FrameScheduler::set_frame_rate(float fps)
+        {
+            fps             = lsp_limit(fps, LSP_TK_FRAME_RATE_MIN, 1000.0f);
+            nMinInterval    = lsp_max(1000.0f / fps, 1.0f);
+            nInterval       = lsp_limit(nInterval, nMinInterval, nMaxInterval);
+        }
+
+        bool FrameScheduler::frame_pending() const
+        {
+            for (size_t i=0, n=vWindows.size(); i<n; ++i)
+            {
+                const Window *wnd   = vWindows.uget(i);
+                if (wnd->render_pending())
+                    return true;
+            }
+            return false;
+        }
+
+        void FrameScheduler::adapt_interval(ws::timestamp_t render_time)
+        {
+            fRenderTime     = (nFrames > 1) ?
+                fRenderTime * 0.875f + render_time * 0.125f :
+                render_time;
+
+            // Leave at least the same amount of time to the event loop as was spent for rendering
+            size_t interval = fRenderTime * 2.0f;
+            nInterval       = lsp_limit(interval, nMinInterval, nMaxInterval);
+        }
+
+        void FrameScheduler::update_fps(ws::timestamp_t time)
+        {
+            if (time < nFpsStart + FPS_PERIOD)
+                return;
+
+            fAchievedFPS    = (nFpsStart > 0) ? (nFpsFrames * 1000.0f) / (time - nFpsStart) : 0.0f;
+            nFpsStart       = time;
+            nFpsFrames      = 0;
+        }
+
+        status_t FrameScheduler::tick_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg)
+        {
+            FrameScheduler *_this   = static_cast<FrameScheduler *>(arg);
+            if (_this == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            return _this->tick(sched, time);
+        }
+
+        status_t FrameScheduler::tick(ws::timestamp_t sched, ws::timestamp_t time)
+        {
+            nTaskID         = -1;
+
+            // The tick is late for more than one frame: the event loop is overloaded,
+            // give it a chance to process events. Never skip two frames in a row.
+            if ((!bSkipped) && (time > sched + nInterval))
+            {
+                bSkipped        = true;
+                ++nSkippedFrames;
+                schedule(time + nInterval);
+                return STATUS_OK;
+            }
+
+            bSkipped        = false;
+            bAnimation      = false;
+            bTicking        = true;
+
+            // Render all windows, the list may change while rendering
+            status_t res    = STATUS_OK;
+            ws::timestamp_t start   = system::get_time_millis();
+            for (size_t i=0; i<vWindows.size(); ++i)
+            {
+                Window *wnd     = vWindows.uget(i);
+
+                // Deliver deferred events before rendering the frame
+                wnd->flush_events();
+                status_t xres   = wnd->do_render();
+                if (res == STATUS_OK)
+                    res             = xres;
+            }
+            ws::timestamp_t end     = system::get_time_millis();
+
+            bTicking        = false;
+            nLastFrame      = end;
+            ++nFrames;
+            ++nFpsFrames;
+            // Surfaces kept over the memory budget while rendering the frame can be evicted now
+            SurfacePool *pool = pDisplay->surface_pool();
+            pool->next_frame();
+            pool->trim();
+
+            adapt_interval(end - start);
+            update_fps(end);
+
+            // Keep ticking while there are changes to render or animation is requested
+            if ((bAnimation) || (frame_pending()))
+                schedule(lsp_max(end, sched + nInterval));
+            else
+                ++nIdle;
+
+            return res;
+        }
+
+        void FrameScheduler::get_stats(frame_stats_t *stats)
+        {
+            if (stats == NULL)
+                return;
+
+            ws::timestamp_t time    = system::get_time_millis();
+            update_fps(time);
+
+            // The scheduler does not tick for a long time
+            if ((nTaskID < 0) && (time >= nLastFrame + FPS_PERIOD))
+                fAchievedFPS    = 0.0f;
+
+            stats->fTargetFPS       = 1000.0f / nInterval;
+            stats->fAchievedFPS     = fAchievedFPS;
+            stats->fRenderTime      = fRenderTime;
+            stats->nWindows         = vWindows.size();
+            stats->nRequests        = nRequests;
+            stats->nFrames          = nFrames;
+            stats->nSkipped         = nSkippedFrames;
+            stats->nIdle            = nIdle;
+            stats->bIdle            = nTaskID < 0;
+        }
+
+        void FrameScheduler::reset_stats()
+        {
+            nFpsStart       = 0;
+            nFpsFrames      = 0;
+            fAchievedFPS    = 0.0f;
+            nRequests       = 0;
+            nFrames         = 0;
+            nSkippedFrames  = 0;
+            nIdle           = 0;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/runtime/system.h>
+#include <private/tk/sys/HeadlessDisplay.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        static constexpr ssize_t SCREEN_WIDTH       = 1920;
+        static constexpr ssize_t SCREEN_HEIGHT      = 1080;
+        static constexpr wssize_t IDLE_PERIOD       = 40;
+
+        HeadlessDisplay::HeadlessDisplay()
+        {
+            bExit           = false;
+        }
+
+        HeadlessDisplay::~HeadlessDisplay()
+        {
+            destroy();
+        }
+
+        status_t HeadlessDisplay::init(int argc, const char **argv)
+        {
+            return ws::IDisplay::init(argc, argv);
+        }
+
+        void HeadlessDisplay::destroy()
+        {
+            // Detach all windows which are still alive
+            lltl::parray<HeadlessWindow> windows;
+            windows.swap(vWindows);
+            for (size_t i=0, n=windows.size(); i<n; ++i)
+                windows.uget(i)->destroy();
+
+            windows.flush();
+            vPending.flush();
+
+            ws::IDisplay::destroy();
+        }
+
+        status_t HeadlessDisplay::main()
+        {
+            bExit           = false;
+
+            while (!bExit)
+            {
+                status_t res    = main_iteration();
+                if (res != STATUS_OK)
+                    return res;
+                if (!bExit)
+                    wait_events(IDLE_PERIOD);
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t HeadlessDisplay::main_iteration()
+        {
+            ws::timestamp_t ts  = system::get_time_millis();
+
+            // Deliver events queued before the iteration, events queued by handlers
+            // will be delivered at the next iteration
+            for (size_t count = vPending.size(); (count > 0) && (vPending.size() > 0); --count)
+            {
+                pending_t ev    = *vPending.uget(0);
+                vPending.remove(0);
+                ev.pWindow->handle_event(&ev.sEvent);
+            }
+
+            // Process timers and the main task
+            status_t res    = process_pending_tasks(ts);
+            if (res != STATUS_OK)
+                return res;
+            call_main_task(ts);
+
+            return STATUS_OK;
+        }
+
+        void HeadlessDisplay::quit_main()
+        {
+            bExit           = true;
+        }
+
+        status_t HeadlessDisplay::wait_events(wssize_t millis)
+        {
+            // There are no external event sources, just wait for timers
+            if ((millis > 0) && (vPending.is_empty()))
+                system::sleep_msec(lsp_min(millis, IDLE_PERIOD));
+            return STATUS_OK;
+        }
+
+        size_t HeadlessDisplay::screens()
+        {
+            return 1;
+        }
+
+        size_t HeadlessDisplay::default_screen()
+        {
+            return 0;
+        }
+
+        status_t HeadlessDisplay::screen_size(size_t screen, ssize_t *w, ssize_t *h)
+        {
+            if (screen != 0)
+                return STATUS_BAD_ARGUMENTS;
+            if (w != NULL)
+                *w  = SCREEN_WIDTH;
+            if (h != NULL)
+                *h  = SCREEN_HEIGHT;
+            return STATUS_OK;
+        }
+
+        ws::IWindow *HeadlessDisplay::create_window()
+        {
+            return create_window(default_screen());
+        }
+
+        ws::IWindow *HeadlessDisplay::create_window(size_t screen)
+        {
+            HeadlessWindow *wnd = new HeadlessWindow(this, screen);
+            if (wnd == NULL)
+                return NULL;
+            if (!vWindows.add(wnd))
+            {
+                delete wnd;
+                return NULL;
+            }
+            return wnd;
+        }
+
+        ws::IWindow *HeadlessDisplay::create_window(void *handle)
+        {
+            // Embedding into native windows is not supported, create top-level window
+            return create_window();
+        }
+
+        ws::IWindow *HeadlessDisplay::wrap_window(void *handle)
+        {
+            return NULL;
+        }
+
+        ws::ISurface *HeadlessDisplay::create_surface(size_t width, size_t height)
+        {
+            HeadlessSurface *s  = new HeadlessSurface(width, height);
+            if ((s != NULL) && (s->data() == NULL))
+            {
+                delete s;
+                return NULL;
+            }
+            return s;
+        }
+
+        bool HeadlessDisplay::get_font_parameters(const ws::Font &f, ws::font_parameters_t *fp)
+        {
+            if (fp != NULL)
+                HeadlessSurface::font_parameters(f, fp);
+            return true;
+        }
+
+        bool HeadlessDisplay::get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const char *text)
+        {
+            if (text == NULL)
+                return false;
+            if (tp != NULL)
+                HeadlessSurface::text_parameters(f, tp, HeadlessSurface::utf8_length(text));
+            return true;
+        }
+
+        bool HeadlessDisplay::get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp,
+            const LSPString *text, ssize_t first, ssize_t last)
+        {
+            if (text == NULL)
+                return false;
+
+            first       = lsp_limit(first, 0, ssize_t(text->length()));
+            last        = lsp_limit(last, first, ssize_t(text->length()));
+            if (tp != NULL)
+                HeadlessSurface::text_parameters(f, tp, last - first);
+            return true;
+        }
+
+        status_t HeadlessDisplay::queue_event(HeadlessWindow *wnd, const ws::event_t *ev)
+        {
+            if ((wnd == NULL) || (ev == NULL))
+                return STATUS_BAD_ARGUMENTS;
+
+            pending_t *p    = vPending.add();
+            if (p == NULL)
+                return STATUS_NO_MEM;
+
+            p->pWindow      = wnd;
+            p->sEvent       = *ev;
+
+            return STATUS_OK;
+        }
+
+        void HeadlessDisplay::remove_window(HeadlessWindow *wnd)
+        {
+            vWindows.premove(wnd);
+
+            for (size_t i=0; i<vPending.size(); )
+            {
+                if (vPending.uget(i)->pWindow == wnd)
+                    vPending.remove(i);
+                else
+                    ++i;
+            }
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <private/tk/sys/HeadlessSurface.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        static constexpr size_t DATA_ALIGNMENT  = 0x40;
+
+        HeadlessSurface::HeadlessSurface(size_t width, size_t height):
+            ws::ISurface(width, height, ws::ST_IMAGE)
+        {
+            vData       = NULL;
+            pData       = NULL;
+
+            size_t count    = lsp_max(width * height, 1u);
+            vData       = lsp::alloc_aligned<uint32_t>(pData, count, DATA_ALIGNMENT);
+            if (vData != NULL)
+                memset(vData, 0, count * sizeof(uint32_t));
+        }
+
+        HeadlessSurface::~HeadlessSurface()
+        {
+            destroy();
+        }
+
+        void HeadlessSurface::destroy()
+        {
+            if (pData != NULL)
+            {
+                lsp::free_aligned(pData);
+                pData       = NULL;
+            }
+            vData       = NULL;
+        }
+
+        ws::ISurface *HeadlessSurface::create(size_t width, size_t height)
+        {
+            HeadlessSurface *s  = new HeadlessSurface(width, height);
+            if ((s != NULL) && (s->vData == NULL))
+            {
+                delete s;
+                return NULL;
+            }
+            return s;
+        }
+
+        void HeadlessSurface::fill(ssize_t left, ssize_t top, ssize_t width, ssize_t height, uint32_t color)
+        {
+            if (vData == NULL)
+                return;
+
+            // Clip the rectangle
+            ssize_t x1  = lsp_max(left, 0);
+            ssize_t y1  = lsp_max(top, 0);
+            ssize_t x2  = lsp_min(left + width, ssize_t(this->width()));
+            ssize_t y2  = lsp_min(top + height, ssize_t(this->height()));
+            if ((x1 >= x2) || (y1 >= y2))
+                return;
+
+            for (ssize_t y=y1; y<y2; ++y)
+            {
+                uint32_t *row   = &vData[y * this->width()];
+                for (ssize_t x=x1; x<x2; ++x)
+                    row[x]          = color;
+            }
+        }
+
+        void HeadlessSurface::clear(const lsp::Color &color)
+        {
+            fill(0, 0, width(), height(), color.rgba32());
+        }
+
+        void HeadlessSurface::clear_rgb(uint32_t color)
+        {
+            fill(0, 0, width(), height(), color & 0xffffff);
+        }
+
+        void HeadlessSurface::clear_rgba(uint32_t color)
+        {
+            fill(0, 0, width(), height(), color);
+        }
+
+        void HeadlessSurface::fill_rect(const lsp::Color &color, size_t mask, float radius,
+            float left, float top, float width, float height)
+        {
+            // Rounded corners are not taken into account
+            fill(left, top, width, height, color.rgba32());
+        }
+
+        void HeadlessSurface::draw(ws::ISurface *s, float x, float y, float sx, float sy, float a)
+        {
+            if ((vData == NULL) || (s == NULL) || (s->type() != ws::ST_IMAGE))
+                return;
+            if ((a >= 1.0f) || (sx <= 0.0f) || (sy <= 0.0f))
+                return;
+
+            HeadlessSurface *src    = static_cast<HeadlessSurface *>(s);
+            if (src->vData == NULL)
+                return;
+
+            // Compute the destination area
+            ssize_t sw  = src->width(), sh = src->height();
+            ssize_t dw  = width(), dh = height();
+            ssize_t x1  = lsp_max(ssize_t(x), 0);
+            ssize_t y1  = lsp_max(ssize_t(y), 0);
+            ssize_t x2  = lsp_min(ssize_t(x + sw * sx), dw);
+            ssize_t y2  = lsp_min(ssize_t(y + sh * sy), dh);
+            if ((x1 >= x2) || (y1 >= y2))
+                return;
+
+            // Copy pixels using nearest neighbour
+            float kx    = 1.0f / sx, ky = 1.0f / sy;
+            for (ssize_t dy=y1; dy<y2; ++dy)
+            {
+                ssize_t ys      = lsp_limit(ssize_t((dy - y) * ky), 0, sh - 1);
+                const uint32_t *srow = &src->vData[ys * sw];
+                uint32_t *drow  = &vData[dy * dw];
+
+                for (ssize_t dx=x1; dx<x2; ++dx)
+                {
+                    ssize_t xs      = lsp_limit(ssize_t((dx - x) * kx), 0, sw - 1);
+                    drow[dx]        = srow[xs];
+                }
+            }
+        }
+
+        size_t HeadlessSurface::utf8_length(const char *text)
+        {
+            size_t count = 0;
+            for ( ; *text != '\0'; ++text)
+            {
+                // Skip continuation bytes
+                if ((uint8_t(*text) & 0xc0) != 0x80)
+                    ++count;
+            }
+            return count;
+        }
+
+        void HeadlessSurface::font_parameters(const ws::Font &f, ws::font_parameters_t *fp)
+        {
+            float size      = lsp_max(0.0f, f.size());
+            fp->Ascent      = ceilf(size * 0.8f);
+            fp->Descent     = ceilf(size * 0.2f);
+            fp->Height      = ceilf(size * 1.2f);
+        }
+
+        void HeadlessSurface::text_parameters(const ws::Font &f, ws::text_parameters_t *tp, size_t length)
+        {
+            // Estimate text size as if the font was monospace
+            float size      = lsp_max(0.0f, f.size());
+            float advance   = ceilf(size * 0.6f);
+
+            tp->XBearing    = 0.0f;
+            tp->YBearing    = - ceilf(size * 0.8f);
+            tp->Width       = advance * length;
+            tp->Height      = ceilf(size * 1.2f);
+            tp->XAdvance    = tp->Width;
+            tp->YAdvance    = 0.0f;
+        }
+
+        bool HeadlessSurface::get_font_parameters(const ws::Font &f, ws::font_parameters_t *fp)
+        {
+            if (fp != NULL)
+                font_parameters(f, fp);
+            return true;
+        }
+
+        bool HeadlessSurface::get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp, const char *text)
+        {
+            if (text == NULL)
+                return false;
+            if (tp != NULL)
+                text_parameters(f, tp, utf8_length(text));
+            return true;
+        }
+
+        bool HeadlessSurface::get_text_parameters(const ws::Font &f, ws::text_parameters_t *tp,
+            const LSPString *text, ssize_t first, ssize_t last)
+        {
+            if (text == NULL)
+                return false;
+
+            first       = lsp_limit(first, 0, ssize_t(text->length()));
+            last        = lsp_limit(last, first, ssize_t(text->length()));
+            if (tp != NULL)
+                text_parameters(f, tp, last - first);
+            return true;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/runtime/system.h>
+#include <private/tk/sys/HeadlessDisplay.h>
+#include <private/tk/sys/HeadlessWindow.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        HeadlessWindow::HeadlessWindow(HeadlessDisplay *dpy, size_t screen):
+            ws::IWindow(dpy, NULL)
+        {
+            pHeadless                   = dpy;
+            pSurface                    = NULL;
+            sSize.nLeft                 = 0;
+            sSize.nTop                  = 0;
+            sSize.nWidth                = 32;
+            sSize.nHeight               = 32;
+            sConstraints.nMinWidth      = -1;
+            sConstraints.nMinHeight     = -1;
+            sConstraints.nMaxWidth      = -1;
+            sConstraints.nMaxHeight     = -1;
+            sConstraints.nPreWidth      = -1;
+            sConstraints.nPreHeight     = -1;
+            nScreen                     = screen;
+            bVisible                    = false;
+        }
+
+        HeadlessWindow::~HeadlessWindow()
+        {
+            destroy();
+        }
+
+        status_t HeadlessWindow::init()
+        {
+            return STATUS_OK;
+        }
+
+        void HeadlessWindow::destroy()
+        {
+            drop_surface();
+            bVisible        = false;
+
+            if (pHeadless != NULL)
+            {
+                pHeadless->remove_window(this);
+                pHeadless       = NULL;
+            }
+        }
+
+        void HeadlessWindow::drop_surface()
+        {
+            if (pSurface != NULL)
+            {
+                pSurface->destroy();
+                delete pSurface;
+                pSurface        = NULL;
+            }
+        }
+
+        void HeadlessWindow::send_event(size_t type)
+        {
+            if (pHeadless == NULL)
+                return;
+
+            ws::event_t ev;
+            ws::init_event(&ev);
+            ev.nType        = type;
+            ev.nLeft        = sSize.nLeft;
+            ev.nTop         = sSize.nTop;
+            ev.nWidth       = sSize.nWidth;
+            ev.nHeight      = sSize.nHeight;
+            ev.nTime        = system::get_time_millis();
+
+            pHeadless->queue_event(this, &ev);
+        }
+
+        void HeadlessWindow::apply_constraints()
+        {
+            if ((sConstraints.nMaxWidth >= 0) && (sSize.nWidth > sConstraints.nMaxWidth))
+                sSize.nWidth    = sConstraints.nMaxWidth;
+            if ((sConstraints.nMaxHeight >= 0) && (sSize.nHeight > sConstraints.nMaxHeight))
+                sSize.nHeight   = sConstraints.nMaxHeight;
+            if ((sConstraints.nMinWidth >= 0) && (sSize.nWidth < sConstraints.nMinWidth))
+                sSize.nWidth    = sConstraints.nMinWidth;
+            if ((sConstraints.nMinHeight >= 0) && (sSize.nHeight < sConstraints.nMinHeight))
+                sSize.nHeight   = sConstraints.nMinHeight;
+
+            sSize.nWidth    = lsp_max(sSize.nWidth, 1);
+            sSize.nHeight   = lsp_max(sSize.nHeight, 1);
+        }
+
+        ws::ISurface *HeadlessWindow::get_surface()
+        {
+            if (!bVisible)
+                return NULL;
+
+            // Re-create surface if the size of the window has changed
+            if ((pSurface != NULL) &&
+                ((ssize_t(pSurface->width()) != sSize.nWidth) || (ssize_t(pSurface->height()) != sSize.nHeight)))
+                drop_surface();
+
+            if (pSurface == NULL)
+            {
+                pSurface        = new HeadlessSurface(sSize.nWidth, sSize.nHeight);
+                if ((pSurface != NULL) && (pSurface->data() == NULL))
+                    drop_surface();
+            }
+
+            return pSurface;
+        }
+
+        size_t HeadlessWindow::screen()
+        {
+            return nScreen;
+        }
+
+        bool HeadlessWindow::is_visible()
+        {
+            return bVisible;
+        }
+
+        status_t HeadlessWindow::move(ssize_t left, ssize_t top)
+        {
+            ws::rectangle_t r   = sSize;
+            r.nLeft             = left;
+            r.nTop              = top;
+            return set_geometry(&r);
+        }
+
+        status_t HeadlessWindow::resize(ssize_t width, ssize_t height)
+        {
+            ws::rectangle_t r   = sSize;
+            r.nWidth            = width;
+            r.nHeight           = height;
+            return set_geometry(&r);
+        }
+
+        status_t HeadlessWindow::set_geometry(const ws::rectangle_t *realize)
+        {
+            if (realize == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            ws::rectangle_t old = sSize;
+            sSize               = *realize;
+            apply_constraints();
+
+            if ((bVisible) && (!Size::equals(&old, &sSize)))
+                send_event(ws::UIE_RESIZE);
+
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::get_geometry(ws::rectangle_t *realize)
+        {
+            if (realize == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            *realize        = sSize;
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::get_absolute_geometry(ws::rectangle_t *realize)
+        {
+            return get_geometry(realize);
+        }
+
+        status_t HeadlessWindow::set_size_constraints(const ws::size_limit_t *c)
+        {
+            if (c == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            sConstraints    = *c;
+            return set_geometry(&sSize);
+        }
+
+        status_t HeadlessWindow::get_size_constraints(ws::size_limit_t *c)
+        {
+            if (c == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            *c              = sConstraints;
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::show()
+        {
+            if (bVisible)
+                return STATUS_OK;
+
+            bVisible        = true;
+            send_event(ws::UIE_SHOW);
+            send_event(ws::UIE_RESIZE);
+
+            return STATUS_OK;
+        }
+
+        status_t HeadlessWindow::show(ws::IWindow *over)
+        {
+            return show();
+        }
+
+        status_t HeadlessWindow::hide()
+        {
+            if (!bVisible)
+                return STATUS_OK;
+
+            bVisible        = false;
+            drop_surface();
+            send_event(ws::UIE_HIDE);
+
+            return STATUS_OK;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
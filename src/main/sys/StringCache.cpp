@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/tk/tk.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        StringCache::StringCache()
+        {
+            pDict           = NULL;
+            nHits           = 0;
+            nMisses         = 0;
+            nFlushes        = 0;
+        }
+
+        StringCache::~StringCache()
+        {
+            destroy();
+        }
+
+        void StringCache::destroy()
+        {
+            lltl::parray<template_t> vt;
+            vTemplates.values(&vt);
+            vTemplates.flush();
+
+            for (size_t i=0, n=vt.size(); i<n; ++i)
+            {
+                template_t *t = vt.uget(i);
+                if (t != NULL)
+                    delete t;
+            }
+            vt.flush();
+
+            pDict           = NULL;
+        }
+
+        void StringCache::invalidate()
+        {
+            if (vTemplates.is_empty())
+                return;
+
+            i18n::IDictionary *dict = pDict;
+            destroy();
+            pDict           = dict;
+            ++nFlushes;
+        }
+
+        bool StringCache::is_plain(const LSPString *text)
+        {
+            for (size_t i=0, n=text->length(); i<n; ++i)
+            {
+                lsp_wchar_t ch = text->char_at(i);
+                if ((ch == '{') || (ch == '}') || (ch == '\\'))
+                    return false;
+            }
+            return true;
+        }
+
+        status_t StringCache::lookup_path(i18n::IDictionary *dict, LSPString *path, LSPString *dst,
+            const char *lang, const LSPString *key)
+        {
+            path->clear();
+            if (!path->append_ascii(lang))
+                return STATUS_NO_MEM;
+            if (!path->append('.'))
+                return STATUS_NO_MEM;
+            if (!path->append(key))
+                return STATUS_NO_MEM;
+
+            return dict->lookup(path, dst);
+        }
+
+        StringCache::template_t *StringCache::resolve(i18n::IDictionary *dict, LSPString *path, const LSPString *lang, const LSPString *key)
+        {
+            template_t *t   = new template_t;
+            if (t == NULL)
+                return NULL;
+
+            // Lookup the corresponding language first, then search in default language
+            status_t res    = dict->lookup(path, &t->sText);
+            if ((res == STATUS_NOT_FOUND) && (lang != NULL) && (!lang->is_empty()))
+            {
+                LSPString tmp;
+                res             = lookup_path(dict, &tmp, &t->sText, LSP_TK_PROP_DEFAULT_LANGUAGE, key);
+            }
+
+            if (res == STATUS_OK)
+            {
+                t->bFound       = true;
+                t->bPlain       = is_plain(&t->sText);
+            }
+            else if (res == STATUS_NOT_FOUND)
+            {
+                t->sText.truncate();
+                t->bFound       = false;
+                t->bPlain       = false;
+            }
+            else
+            {
+                delete t;
+                return NULL;
+            }
+
+            // Store the template
+            if (!vTemplates.create(path, t))
+            {
+                delete t;
+                return NULL;
+            }
+
+            return t;
+        }
+
+        const StringCache::template_t *StringCache::get(i18n::IDictionary *dict, const LSPString *lang, const LSPString *key)
+        {
+            if ((dict == NULL) || (key == NULL))
+                return NULL;
+
+            // Templates resolved from another dictionary are not valid anymore
+            if (dict != pDict)
+            {
+                invalidate();
+                pDict           = dict;
+            }
+
+            // Form the lookup path
+            LSPString path;
+            if ((lang != NULL) && (!lang->is_empty()))
+            {
+                if (!path.append(lang))
+                    return NULL;
+            }
+            else if (!path.append_ascii(LSP_TK_PROP_DEFAULT_LANGUAGE))
+                return NULL;
+            if (!path.append('.'))
+                return NULL;
+            if (!path.append(key))
+                return NULL;
+
+            // Lookup the cache
+            template_t *t   = vTemplates.get(&path);
+            if (t != NULL)
+            {
+                ++nHits;
+                return t;
+            }
+
+            ++nMisses;
+            return resolve(dict, &path, lang, key);
+        }
+
+        void StringCache::get_stats(string_cache_stats_t *stats) const
+        {
+            if (stats == NULL)
+                return;
+
+            stats->nEntries     = vTemplates.size();
+            stats->nHits        = nHits;
+            stats->nMisses      = nMisses;
+            stats->nFlushes     = nFlushes;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
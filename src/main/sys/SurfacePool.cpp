@@ -0,0 +1,376 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/debug.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        SurfacePool::SurfacePool()
+        {
+            nBudget         = LSP_TK_SURFACE_POOL_BUDGET;
+            nUsedBytes      = 0;
+            nFreeBytes      = 0;
+            nWindow         = 0;
+            nWindowBytes    = 0;
+            nFrame          = 0;
+            nAllocated      = 0;
+            nReused         = 0;
+            nEvicted        = 0;
+        }
+
+        SurfacePool::~SurfacePool()
+        {
+            destroy();
+        }
+
+        void SurfacePool::destroy_entry(entry_t *e)
+        {
+            if (e == NULL)
+                return;
+
+            if (e->pSurface != NULL)
+            {
+                e->pSurface->destroy();
+                delete e->pSurface;
+                e->pSurface     = NULL;
+            }
+
+            delete e;
+        }
+
+        void SurfacePool::destroy()
+        {
+            // Detach surfaces from owners
+            for (size_t i=0, n=vUsed.size(); i<n; ++i)
+            {
+                entry_t *e      = vUsed.uget(i);
+                Widget *w       = e->pOwner;
+                if ((w != NULL) && (w->pSurface == e->pSurface))
+                {
+                    w->pSurface     = NULL;
+                    w->nFlags      |= Widget::REDRAW_SURFACE;
+                }
+                destroy_entry(e);
+            }
+            vUsed.flush();
+
+            // Destroy free surfaces
+            for (size_t i=0, n=vFree.size(); i<n; ++i)
+                destroy_entry(vFree.uget(i));
+            vFree.flush();
+
+            nUsedBytes      = 0;
+            nFreeBytes      = 0;
+            nWindow         = 0;
+            nWindowBytes    = 0;
+        }
+
+        size_t SurfacePool::size_class(size_t value)
+        {
+            // Coarse granularity for large surfaces keeps the memory overhead
+            // within the reasonable limits
+            size_t step     = (value <= 256) ? 32 :
+                              (value <= 1024) ? 64 : 128;
+            return align_size(value, step);
+        }
+
+        bool SurfacePool::matches(const ws::ISurface *s, size_t width, size_t height)
+        {
+            return (s->width() == width) && (s->height() == height);
+        }
+
+        bool SurfacePool::fits(const ws::ISurface *s, ssize_t width, ssize_t height, bool exact)
+        {
+            if ((s == NULL) || (!s->valid()))
+                return false;
+            if ((width <= 0) || (height <= 0))
+                return false;
+
+            return (exact) ?
+                matches(s, width, height) :
+                matches(s, size_class(width), size_class(height));
+        }
+
+        bool SurfacePool::is_hidden(const Widget *w)
+        {
+            for ( ; w != NULL; w = w->pParent)
+            {
+                if (!w->sVisibility.get())
+                    return true;
+            }
+            return false;
+        }
+
+        bool SurfacePool::is_window(Widget *w)
+        {
+            return widget_cast<Window>(w) != NULL;
+        }
+
+        ssize_t SurfacePool::cmp_eviction(const entry_t *a, const entry_t *b)
+        {
+            // Surfaces of hidden widgets go first
+            bool ha         = is_hidden(a->pOwner);
+            bool hb         = is_hidden(b->pOwner);
+            if (ha != hb)
+                return (ha) ? -1 : 1;
+
+            // Then least recently used surfaces go
+            size_t fa       = a->pOwner->nSurfaceFrame;
+            size_t fb       = b->pOwner->nSurfaceFrame;
+            if (fa != fb)
+                return (fa < fb) ? -1 : 1;
+
+            // Prefer larger surfaces to be evicted
+            return (a->nBytes > b->nBytes) ? -1 :
+                   (a->nBytes < b->nBytes) ? 1 : 0;
+        }
+
+        ssize_t SurfacePool::index_of_used(const ws::ISurface *s) const
+        {
+            // Recently acquired surfaces are more likely to be released
+            for (ssize_t i=vUsed.size() - 1; i >= 0; --i)
+            {
+                const entry_t *e    = vUsed.uget(i);
+                if (e->pSurface == s)
+                    return i;
+            }
+            return -1;
+        }
+
+        void SurfacePool::drop_free(size_t count)
+        {
+            // Drop the least recently released surfaces
+            count   = lsp_min(count, vFree.size());
+            for (size_t i=0; i<count; ++i)
+            {
+                entry_t *e      = vFree.uget(i);
+                nFreeBytes     -= e->nBytes;
+                destroy_entry(e);
+            }
+            vFree.remove_n(0, count);
+        }
+
+        void SurfacePool::add_used(entry_t *e, Widget *owner)
+        {
+            // Back buffer of the window is redrawn each frame and can not be evicted,
+            // so it is accounted separately from the budget
+            e->pOwner       = owner;
+            e->bWindow      = is_window(owner);
+            if (e->bWindow)
+            {
+                ++nWindow;
+                nWindowBytes   += e->nBytes;
+            }
+            else
+                nUsedBytes     += e->nBytes;
+        }
+
+        void SurfacePool::remove_used(entry_t *e)
+        {
+            if (e->bWindow)
+            {
+                --nWindow;
+                nWindowBytes   -= e->nBytes;
+            }
+            else
+                nUsedBytes     -= e->nBytes;
+            e->pOwner       = NULL;
+            e->bWindow      = false;
+        }
+
+        void SurfacePool::enforce_budget(const entry_t *keep)
+        {
+            if (nBudget <= 0)
+                return;
+
+            // Drop free surfaces first
+            size_t count = 0;
+            for (size_t total = nUsedBytes + nFreeBytes, n = vFree.size(); (total > nBudget) && (count < n); ++count)
+                total          -= vFree.uget(count)->nBytes;
+            if (count > 0)
+                drop_free(count);
+            if (nUsedBytes <= nBudget)
+                return;
+
+            // Collect surfaces of widgets that were not drawn in the current frame
+            lltl::parray<entry_t> list;
+            for (size_t i=0, n=vUsed.size(); i<n; ++i)
+            {
+                entry_t *e      = vUsed.uget(i);
+                if ((e == keep) || (e->pOwner == NULL) || (e->bWindow))
+                    continue;
+                if ((e->pOwner->nSurfaceFrame >= nFrame) && (!is_hidden(e->pOwner)))
+                    continue;
+                if (!list.add(e))
+                    return;
+            }
+            list.qsort(cmp_eviction);
+
+            // Evict surfaces until the budget is satisfied
+            for (size_t i=0, n=list.size(); (i < n) && (nUsedBytes > nBudget); ++i)
+                evict(list.uget(i));
+        }
+
+        void SurfacePool::evict(entry_t *e)
+        {
+            // The owner should redraw it's contents on the newly acquired surface
+            Widget *w       = e->pOwner;
+            if (w != NULL)
+            {
+                if (w->pSurface == e->pSurface)
+                    w->pSurface     = NULL;
+                w->nFlags      |= Widget::REDRAW_SURFACE;
+            }
+
+            vUsed.premove(e);
+            remove_used(e);
+            ++nEvicted;
+            destroy_entry(e);
+        }
+
+        ws::ISurface *SurfacePool::acquire(Widget *owner, ws::ISurface *factory, ssize_t width, ssize_t height, bool exact)
+        {
+            if ((width <= 0) || (height <= 0))
+                return NULL;
+
+            size_t sw       = (exact) ? width  : size_class(width);
+            size_t sh       = (exact) ? height : size_class(height);
+            entry_t *e      = NULL;
+
+            // Lookup for the most recently released surface of the same size class
+            for (ssize_t i=vFree.size() - 1; i >= 0; --i)
+            {
+                entry_t *xe     = vFree.uget(i);
+                if (!matches(xe->pSurface, sw, sh))
+                    continue;
+                if (!xe->pSurface->valid())
+                    continue;
+
+                if (!vUsed.add(xe))
+                    return NULL;
+                vFree.remove(i);
+                nFreeBytes     -= xe->nBytes;
+                ++nReused;
+                e               = xe;
+                break;
+            }
+
+            // Allocate new surface if there is nothing to reuse
+            if (e == NULL)
+            {
+                if (factory == NULL)
+                    return NULL;
+
+                ws::ISurface *s = factory->create(sw, sh);
+                if (s == NULL)
+                    return NULL;
+
+                e               = new entry_t;
+                if (e == NULL)
+                {
+                    s->destroy();
+                    delete s;
+                    return NULL;
+                }
+                e->pSurface     = s;
+                e->pOwner       = NULL;
+                e->nBytes       = sw * sh * sizeof(uint32_t);
+                e->bWindow      = false;
+
+                if (!vUsed.add(e))
+                {
+                    destroy_entry(e);
+                    return NULL;
+                }
+                ++nAllocated;
+            }
+
+            add_used(e, owner);
+            enforce_budget(e);
+
+            return e->pSurface;
+        }
+
+        void SurfacePool::release(ws::ISurface *s)
+        {
+            if (s == NULL)
+                return;
+
+            ssize_t idx     = index_of_used(s);
+            if (idx < 0)
+            {
+                // Surface does not belong to the pool
+                s->destroy();
+                delete s;
+                return;
+            }
+
+            entry_t *e      = vUsed.uget(idx);
+            vUsed.qremove(idx);
+            remove_used(e);
+
+            // Invalid surfaces can not be reused
+            if ((!s->valid()) || (!vFree.add(e)))
+            {
+                destroy_entry(e);
+                return;
+            }
+
+            nFreeBytes     += e->nBytes;
+            enforce_budget(NULL);
+        }
+
+        void SurfacePool::flush()
+        {
+            drop_free(vFree.size());
+        }
+
+        void SurfacePool::set_budget(size_t bytes)
+        {
+            nBudget         = bytes;
+            enforce_budget(NULL);
+        }
+
+        void SurfacePool::trim()
+        {
+            enforce_budget(NULL);
+        }
+
+        void SurfacePool::get_stats(surface_pool_stats_t *stats) const
+        {
+            stats->nBudget      = nBudget;
+            stats->nUsed        = vUsed.size() - nWindow;
+            stats->nUsedBytes   = nUsedBytes;
+            stats->nFree        = vFree.size();
+            stats->nFreeBytes   = nFreeBytes;
+            stats->nWindow      = nWindow;
+            stats->nWindowBytes = nWindowBytes;
+            stats->nAllocated   = nAllocated;
+            stats->nReused      = nReused;
+            stats->nEvicted     = nEvicted;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
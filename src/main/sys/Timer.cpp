@@ -36,6 +36,12 @@ namespace lsp
             nFlags          = TF_DEFAULT;
             nErrorCode      = STATUS_OK;
             nTaskID         = -1;
+
+            pWheel          = NULL;
+            pWheelPrev      = NULL;
+            pWheelNext      = NULL;
+            nDeadline       = 0;
+            nWheelSlot      = -1;
         }
 
         Timer::~Timer()
@@ -58,8 +64,11 @@ namespace lsp
                 return STATUS_OK;
             }
 
-            // Submit task to display's queue
+            // Submit task to the timer wheel or to display's queue
             ws::timestamp_t time    = lsp_max(ctime, sched + nRepeatInterval);
+            if (pWheel != NULL)
+                return pWheel->schedule(this, time);
+
             nTaskID     = pDisplay->submit_task(time, execute, this);
             if (nTaskID < 0)
                 return -nTaskID;
@@ -113,6 +122,7 @@ namespace lsp
 
             // Store new display pointer
             pDisplay        = dpy;
+            pWheel          = NULL;
         }
 
         void Timer::bind(Display *dpy)
@@ -122,6 +132,7 @@ namespace lsp
 
             // Store new display pointer
             pDisplay        = dpy->display();
+            pWheel          = dpy->timer_wheel();
         }
 
         status_t Timer::launch(ssize_t count, size_t interval, ws::timestamp_t delay)
@@ -139,12 +150,20 @@ namespace lsp
             nRepeatInterval = interval;
 
             // Submit first task: compute the acutal time when the event should trigger
-            if (delay > 0)
-                delay      += system::get_time_millis();
+            if (pWheel != NULL)
+            {
+                if ((result = pWheel->schedule(this, system::get_time_millis() + delay)) != STATUS_OK)
+                    return result;
+            }
+            else
+            {
+                if (delay > 0)
+                    delay      += system::get_time_millis();
 
-            nTaskID     = pDisplay->submit_task(delay, execute, this);
-            if (nTaskID < 0)
-                return -nTaskID;
+                nTaskID     = pDisplay->submit_task(delay, execute, this);
+                if (nTaskID < 0)
+                    return -nTaskID;
+            }
 
             nFlags         |= TF_LAUNCHED;
             return result;
@@ -171,8 +190,10 @@ namespace lsp
             if (pDisplay == NULL)
                 return STATUS_NOT_BOUND;
 
-            // Cancel task if present
-            if (nTaskID >= 0)
+            // Remove timer from the wheel or cancel task if present
+            if (nWheelSlot >= 0)
+                pWheel->cancel(this);
+            else if (nTaskID >= 0)
             {
                 pDisplay->cancel_task(nTaskID);
                 nTaskID = -1;
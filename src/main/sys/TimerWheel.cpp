@@ -0,0 +1,392 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/runtime/system.h>
+#include <lsp-plug.in/common/debug.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        static constexpr ws::timestamp_t RATE_PERIOD    = 1000;
+
+        TimerWheel::TimerWheel(Display *dpy)
+        {
+            pDisplay        = dpy;
+            for (size_t i=0; i<SLOTS; ++i)
+            {
+                vSlots[i].pHead     = NULL;
+                vSlots[i].pTail     = NULL;
+            }
+            for (size_t i=0; i<=LEVELS; ++i)
+                vCount[i]       = 0;
+            nCurrent        = 0;
+            nWakeup         = 0;
+            nTaskID         = -1;
+            nActive         = 0;
+            bProcessing     = false;
+
+            nRateStart      = 0;
+            nRateWakeups    = 0;
+            fWakeupRate     = 0.0f;
+            nWakeups        = 0;
+            nExpired        = 0;
+        }
+
+        TimerWheel::~TimerWheel()
+        {
+            destroy();
+        }
+
+        void TimerWheel::destroy()
+        {
+            // Cancel the wakeup
+            if (nTaskID >= 0)
+            {
+                ws::IDisplay *dpy = (pDisplay != NULL) ? pDisplay->display() : NULL;
+                if (dpy != NULL)
+                    dpy->cancel_task(nTaskID);
+                nTaskID         = -1;
+            }
+
+            // Detach all timers from the wheel
+            for (size_t i=0; i<SLOTS; ++i)
+            {
+                for (Timer *t = vSlots[i].pHead; t != NULL; )
+                {
+                    Timer *next         = t->pWheelNext;
+                    t->pWheelPrev       = NULL;
+                    t->pWheelNext       = NULL;
+                    t->nWheelSlot       = -1;
+                    t->pWheel           = NULL;
+                    t                   = next;
+                }
+                vSlots[i].pHead     = NULL;
+                vSlots[i].pTail     = NULL;
+            }
+            for (size_t i=0; i<=LEVELS; ++i)
+                vCount[i]       = 0;
+            nActive         = 0;
+        }
+
+        inline ws::timestamp_t TimerWheel::to_tick(ws::timestamp_t time)
+        {
+            return (time + LSP_TK_TIMER_WHEEL_RESOLUTION - 1) / LSP_TK_TIMER_WHEEL_RESOLUTION;
+        }
+
+        inline ws::timestamp_t TimerWheel::to_time(ws::timestamp_t tick)
+        {
+            return tick * LSP_TK_TIMER_WHEEL_RESOLUTION;
+        }
+
+        size_t TimerWheel::slot_level(size_t slot)
+        {
+            if (slot < L0_SIZE)
+                return 0;
+            return (slot < OVERFLOW) ? 1 + (slot - L0_SIZE) / LN_SIZE : LEVELS;
+        }
+
+        void TimerWheel::link(Timer *t)
+        {
+            // Select the level depending on the distance to the deadline
+            ws::timestamp_t tick    = t->nDeadline;
+            ws::timestamp_t delta   = tick - nCurrent;
+            size_t slot, level;
+
+            if (delta < ws::timestamp_t(1) << L0_BITS)
+            {
+                slot            = tick & (L0_SIZE - 1);
+                level           = 0;
+            }
+            else if (delta < ws::timestamp_t(1) << (L0_BITS + LN_BITS))
+            {
+                slot            = L0_SIZE + ((tick >> L0_BITS) & (LN_SIZE - 1));
+                level           = 1;
+            }
+            else if (delta < ws::timestamp_t(1) << (L0_BITS + LN_BITS * 2))
+            {
+                slot            = L0_SIZE + LN_SIZE + ((tick >> (L0_BITS + LN_BITS)) & (LN_SIZE - 1));
+                level           = 2;
+            }
+            else
+            {
+                slot            = OVERFLOW;
+                level           = LEVELS;
+            }
+
+            // Append timer to the end of the slot
+            slot_t *s           = &vSlots[slot];
+            t->nWheelSlot       = slot;
+            t->pWheelPrev       = s->pTail;
+            t->pWheelNext       = NULL;
+            if (s->pTail != NULL)
+                s->pTail->pWheelNext    = t;
+            else
+                s->pHead        = t;
+            s->pTail            = t;
+
+            ++vCount[level];
+            ++nActive;
+        }
+
+        void TimerWheel::unlink(Timer *t)
+        {
+            if (t->nWheelSlot < 0)
+                return;
+
+            slot_t *s           = &vSlots[t->nWheelSlot];
+            if (t->pWheelPrev != NULL)
+                t->pWheelPrev->pWheelNext   = t->pWheelNext;
+            else
+                s->pHead        = t->pWheelNext;
+            if (t->pWheelNext != NULL)
+                t->pWheelNext->pWheelPrev   = t->pWheelPrev;
+            else
+                s->pTail        = t->pWheelPrev;
+
+            --vCount[slot_level(t->nWheelSlot)];
+            --nActive;
+
+            t->pWheelPrev       = NULL;
+            t->pWheelNext       = NULL;
+            t->nWheelSlot       = -1;
+        }
+
+        void TimerWheel::cascade(size_t first, size_t count)
+        {
+            for (size_t i=first, n=first+count; i<n; ++i)
+            {
+                // Detach the list of timers and place them into lower levels
+                Timer *t            = vSlots[i].pHead;
+                vSlots[i].pHead     = NULL;
+                vSlots[i].pTail     = NULL;
+
+                size_t level        = slot_level(i);
+                while (t != NULL)
+                {
+                    Timer *next         = t->pWheelNext;
+                    --vCount[level];
+                    --nActive;
+                    link(t);
+                    t                   = next;
+                }
+            }
+        }
+
+        void TimerWheel::expire(ws::timestamp_t tick, ws::timestamp_t time)
+        {
+            slot_t *s           = &vSlots[tick & (L0_SIZE - 1)];
+
+            while (true)
+            {
+                // Timers re-scheduled by handlers are appended to other slots or
+                // to the end of this slot with the later deadline
+                Timer *t            = s->pHead;
+                while ((t != NULL) && (t->nDeadline > tick))
+                    t                   = t->pWheelNext;
+                if (t == NULL)
+                    break;
+
+                unlink(t);
+                ++nExpired;
+                t->execute_task(to_time(tick), time, NULL);
+            }
+        }
+
+        void TimerWheel::advance(ws::timestamp_t tick, ws::timestamp_t time)
+        {
+            constexpr ws::timestamp_t l0_mask   = (ws::timestamp_t(1) << L0_BITS) - 1;
+            constexpr ws::timestamp_t l1_mask   = (ws::timestamp_t(1) << (L0_BITS + LN_BITS)) - 1;
+            constexpr ws::timestamp_t l2_mask   = (ws::timestamp_t(1) << (L0_BITS + LN_BITS * 2)) - 1;
+
+            while ((nCurrent <= tick) && (nActive > 0))
+            {
+                ws::timestamp_t current = nCurrent;
+
+                // Cascade timers from upper levels when the lower level wraps
+                if ((current & l0_mask) == 0)
+                {
+                    if ((current & l1_mask) == 0)
+                    {
+                        if ((current & l2_mask) == 0)
+                            cascade(OVERFLOW, 1);
+                        cascade(L0_SIZE + LN_SIZE + ((current >> (L0_BITS + LN_BITS)) & (LN_SIZE - 1)), 1);
+                    }
+                    cascade(L0_SIZE + ((current >> L0_BITS) & (LN_SIZE - 1)), 1);
+                }
+
+                ++nCurrent;
+                expire(current, time);
+
+                // Skip ticks up to the next cascade when the first level is empty
+                if ((vCount[0] == 0) && (nCurrent <= tick))
+                    nCurrent        = lsp_min((nCurrent + l0_mask) & (~l0_mask), tick + 1);
+            }
+
+            // Nothing to process, just move to the current time
+            if (nCurrent <= tick)
+                nCurrent        = tick + 1;
+        }
+
+        ws::timestamp_t TimerWheel::earliest() const
+        {
+            ws::timestamp_t result  = ws::timestamp_t(-1);
+
+            // Timers of the first level are sorted by slots
+            if (vCount[0] > 0)
+            {
+                for (size_t i=0; i<L0_SIZE; ++i)
+                {
+                    const Timer *t      = vSlots[(nCurrent + i) & (L0_SIZE - 1)].pHead;
+                    if (t != NULL)
+                    {
+                        result              = t->nDeadline;
+                        break;
+                    }
+                }
+            }
+
+            // Timers of upper levels may expire earlier than the far timers of the first level
+            if (nActive > vCount[0])
+            {
+                for (size_t i=L0_SIZE; i<SLOTS; ++i)
+                    for (const Timer *t = vSlots[i].pHead; t != NULL; t = t->pWheelNext)
+                        result              = lsp_min(result, t->nDeadline);
+            }
+
+            return result;
+        }
+
+        void TimerWheel::update_wakeup()
+        {
+            ws::IDisplay *dpy = (pDisplay != NULL) ? pDisplay->display() : NULL;
+            if (dpy == NULL)
+                return;
+
+            // Cancel the wakeup if there are no timers
+            if (nActive <= 0)
+            {
+                if (nTaskID >= 0)
+                {
+                    dpy->cancel_task(nTaskID);
+                    nTaskID         = -1;
+                }
+                return;
+            }
+
+            // Check that the wakeup matches the earliest deadline
+            ws::timestamp_t tick    = earliest();
+            if ((nTaskID >= 0) && (nWakeup == tick))
+                return;
+
+            if (nTaskID >= 0)
+                dpy->cancel_task(nTaskID);
+            nWakeup         = tick;
+            nTaskID         = dpy->submit_task(to_time(tick), wakeup_handler, this);
+        }
+
+        void TimerWheel::update_rate(ws::timestamp_t time)
+        {
+            if (time < nRateStart + RATE_PERIOD)
+                return;
+
+            fWakeupRate     = (nRateStart > 0) ? (nRateWakeups * 1000.0f) / (time - nRateStart) : 0.0f;
+            nRateStart      = time;
+            nRateWakeups    = 0;
+        }
+
+        status_t TimerWheel::wakeup_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg)
+        {
+            TimerWheel *_this   = static_cast<TimerWheel *>(arg);
+            if (_this == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            return _this->wakeup(sched, time);
+        }
+
+        status_t TimerWheel::wakeup(ws::timestamp_t sched, ws::timestamp_t time)
+        {
+            nTaskID         = -1;
+            ++nWakeups;
+            ++nRateWakeups;
+            update_rate(time);
+
+            // Expire all timers with the deadline not later than the current time
+            bProcessing     = true;
+            advance(lsp_max(time / LSP_TK_TIMER_WHEEL_RESOLUTION, nWakeup), time);
+            bProcessing     = false;
+
+            update_wakeup();
+
+            return STATUS_OK;
+        }
+
+        status_t TimerWheel::schedule(Timer *t, ws::timestamp_t time)
+        {
+            unlink(t);
+
+            // Synchronize the wheel with the current time if it is empty
+            if ((nActive <= 0) && (!bProcessing))
+                nCurrent        = lsp_max(nCurrent, system::get_time_millis() / LSP_TK_TIMER_WHEEL_RESOLUTION);
+
+            t->nDeadline    = lsp_max(to_tick(time), nCurrent);
+            link(t);
+
+            if (!bProcessing)
+                update_wakeup();
+
+            return STATUS_OK;
+        }
+
+        void TimerWheel::cancel(Timer *t)
+        {
+            if (t->nWheelSlot < 0)
+                return;
+
+            unlink(t);
+            if (!bProcessing)
+                update_wakeup();
+        }
+
+        void TimerWheel::get_stats(timer_wheel_stats_t *stats) const
+        {
+            if (stats == NULL)
+                return;
+
+            stats->nActive      = nActive;
+            stats->nWakeups     = nWakeups;
+            stats->nExpired     = nExpired;
+            stats->fWakeupRate  = fWakeupRate;
+        }
+
+        void TimerWheel::reset_stats()
+        {
+            nRateStart      = 0;
+            nRateWakeups    = 0;
+            fWakeupRate     = 0.0f;
+            nWakeups        = 0;
+            nExpired        = 0;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/common/debug.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        WindowPool::WindowPool(Display *dpy)
+        {
+            pDisplay        = dpy;
+            nCapacity       = LSP_TK_WINDOW_POOL_CAPACITY;
+            nCreated        = 0;
+            nReused         = 0;
+            nResized        = 0;
+            nDestroyed      = 0;
+        }
+
+        WindowPool::~WindowPool()
+        {
+            destroy();
+        }
+
+        void WindowPool::destroy()
+        {
+            shrink(0);
+            vFree.flush();
+        }
+
+        void WindowPool::destroy_window(ws::IWindow *wnd)
+        {
+            if (wnd == NULL)
+                return;
+
+            wnd->destroy();
+            delete wnd;
+        }
+
+        bool WindowPool::same_size_class(ws::IWindow *wnd, ssize_t width, ssize_t height)
+        {
+            if ((width < 0) || (height < 0))
+                return true;
+
+            ws::rectangle_t r;
+            if (wnd->get_geometry(&r) != STATUS_OK)
+                return false;
+
+            return (SurfacePool::size_class(lsp_max(r.nWidth, 1)) == SurfacePool::size_class(lsp_max(width, 1))) &&
+                   (SurfacePool::size_class(lsp_max(r.nHeight, 1)) == SurfacePool::size_class(lsp_max(height, 1)));
+        }
+
+        ws::IWindow *WindowPool::create_window(size_t screen)
+        {
+            ws::IDisplay *dpy   = (pDisplay != NULL) ? pDisplay->display() : NULL;
+            if (dpy == NULL)
+                return NULL;
+
+            ws::IWindow *wnd    = dpy->create_window(screen);
+            if (wnd == NULL)
+                return NULL;
+
+            if (wnd->init() != STATUS_OK)
+            {
+                destroy_window(wnd);
+                return NULL;
+            }
+
+            ++nCreated;
+            return wnd;
+        }
+
+        void WindowPool::shrink(size_t count)
+        {
+            while (vFree.size() > count)
+            {
+                // Destroy the least recently used window first
+                ws::IWindow *wnd    = vFree.uget(0);
+                vFree.remove(0);
+                destroy_window(wnd);
+                ++nDestroyed;
+            }
+        }
+
+        status_t WindowPool::prewarm(size_t count)
+        {
+            ws::IDisplay *dpy   = (pDisplay != NULL) ? pDisplay->display() : NULL;
+            if (dpy == NULL)
+                return STATUS_BAD_STATE;
+
+            count               = lsp_min(count, nCapacity);
+            size_t screen       = dpy->default_screen();
+
+            while (vFree.size() < count)
+            {
+                ws::IWindow *wnd    = create_window(screen);
+                if (wnd == NULL)
+                    return STATUS_NO_MEM;
+                if (!vFree.insert(0, wnd))
+                {
+                    destroy_window(wnd);
+                    return STATUS_NO_MEM;
+                }
+            }
+
+            return STATUS_OK;
+        }
+
+        ws::IWindow *WindowPool::acquire(size_t screen, ssize_t width, ssize_t height)
+        {
+            // Lookup for the most recently used window of the same screen and size class
+            ssize_t index       = -1;
+            for (ssize_t i=vFree.size() - 1; i >= 0; --i)
+            {
+                ws::IWindow *wnd    = vFree.uget(i);
+                if (wnd->screen() != screen)
+                    continue;
+                if (same_size_class(wnd, width, height))
+                {
+                    index               = i;
+                    break;
+                }
+                if (index < 0)
+                    index               = i;
+            }
+
+            if (index < 0)
+                return create_window(screen);
+
+            ws::IWindow *wnd    = vFree.uget(index);
+            vFree.remove(index);
+            ++nReused;
+            if (!same_size_class(wnd, width, height))
+                ++nResized;
+
+            return wnd;
+        }
+
+        void WindowPool::release(ws::IWindow *wnd)
+        {
+            if (wnd == NULL)
+                return;
+
+            wnd->hide();
+            wnd->set_handler(NULL);
+
+            if ((vFree.size() >= nCapacity) || (!vFree.add(wnd)))
+            {
+                destroy_window(wnd);
+                ++nDestroyed;
+            }
+        }
+
+        void WindowPool::set_capacity(size_t capacity)
+        {
+            nCapacity       = capacity;
+            shrink(nCapacity);
+        }
+
+        void WindowPool::get_stats(window_pool_stats_t *stats) const
+        {
+            if (stats == NULL)
+                return;
+
+            stats->nCapacity    = nCapacity;
+            stats->nFree        = vFree.size();
+            stats->nCreated     = nCreated;
+            stats->nReused      = nReused;
+            stats->nResized     = nResized;
+            stats->nDestroyed   = nDestroyed;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
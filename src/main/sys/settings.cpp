@@ -29,12 +29,14 @@ namespace lsp
         {
             resources       = NULL;
             environment     = NULL;
+            headless        = false;
         }
 
         void display_settings_t::construct()
         {
             resources       = NULL;
             environment     = NULL;
+            headless        = false;
         }
     }
 }
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/tk/tk.h>
+
+namespace lsp
+{
+    namespace tk
+    {
+        HitIndex::HitIndex()
+        {
+            bDirty          = false;
+        }
+
+        HitIndex::~HitIndex()
+        {
+            vNodes.flush();
+        }
+
+        void HitIndex::clear()
+        {
+            vNodes.clear();
+            bDirty          = false;
+        }
+
+        status_t HitIndex::add(Widget *w)
+        {
+            if (w == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            ws::rectangle_t r;
+            w->get_rectangle(&r);
+            return add(w, &r);
+        }
+
+        status_t HitIndex::add(Widget *w, const ws::rectangle_t *r)
+        {
+            if ((w == NULL) || (r == NULL))
+                return STATUS_BAD_ARGUMENTS;
+
+            // Widgets that have no area can not be hit
+            if ((r->nWidth <= 0) || (r->nHeight <= 0))
+                return STATUS_OK;
+
+            node_t *n       = vNodes.add();
+            if (n == NULL)
+                return STATUS_NO_MEM;
+
+            n->sRect        = *r;
+            n->pWidget      = w;
+            n->nOrder       = vNodes.size() - 1;
+            n->nMaxBottom   = r->nTop + r->nHeight;
+            bDirty          = true;
+
+            return STATUS_OK;
+        }
+
+        ssize_t HitIndex::cmp_nodes(const node_t *a, const node_t *b)
+        {
+            if (a->sRect.nTop != b->sRect.nTop)
+                return (a->sRect.nTop < b->sRect.nTop) ? -1 : 1;
+            return (a->nOrder < b->nOrder) ? -1 : (a->nOrder > b->nOrder) ? 1 : 0;
+        }
+
+        ssize_t HitIndex::build_tree(size_t first, size_t last)
+        {
+            // The sorted array forms implicit balanced tree: the middle element
+            // of the range is the root, left and right halves are subtrees
+            size_t mid      = (first + last) >> 1;
+            node_t *n       = vNodes.uget(mid);
+            ssize_t bottom  = n->sRect.nTop + n->sRect.nHeight;
+
+            if (first < mid)
+                bottom          = lsp_max(bottom, build_tree(first, mid));
+            if ((mid + 1) < last)
+                bottom          = lsp_max(bottom, build_tree(mid + 1, last));
+
+            n->nMaxBottom   = bottom;
+            return bottom;
+        }
+
+        void HitIndex::build()
+        {
+            if (!bDirty)
+                return;
+
+            if (vNodes.size() > 0)
+            {
+                vNodes.qsort(cmp_nodes);
+                build_tree(0, vNodes.size());
+            }
+            bDirty          = false;
+        }
+
+        void HitIndex::lookup(const node_t **found, size_t first, size_t last, ssize_t x, ssize_t y, Widget *parent) const
+        {
+            while (first < last)
+            {
+                size_t mid      = (first + last) >> 1;
+                const node_t *n = vNodes.uget(mid);
+
+                // No intervals in the subtree cover the point
+                if (n->nMaxBottom <= y)
+                    return;
+
+                // Lookup the left subtree
+                lookup(found, first, mid, x, y, parent);
+
+                // All nodes in the right subtree start below the point
+                if (n->sRect.nTop > y)
+                    return;
+
+                // Check the node itself
+                if (((*found == NULL) || (n->nOrder < (*found)->nOrder)) &&
+                    (x >= n->sRect.nLeft) && (x < (n->sRect.nLeft + n->sRect.nWidth)) &&
+                    (y < (n->sRect.nTop + n->sRect.nHeight)))
+                {
+                    Widget *w       = n->pWidget;
+                    if (((parent == NULL) || (w->is_visible_child_of(parent))) && (w->inside(x, y)))
+                        *found          = n;
+                }
+
+                // Continue with the right subtree
+                first           = mid + 1;
+            }
+        }
+
+        Widget *HitIndex::find(ssize_t x, ssize_t y, Widget *parent) const
+        {
+            const node_t *found = NULL;
+
+            if (bDirty)
+            {
+                // The index has not been built, perform the linear scan
+                for (size_t i=0, n=vNodes.size(); i<n; ++i)
+                {
+                    const node_t *xn    = vNodes.uget(i);
+                    Widget *w           = xn->pWidget;
+                    if ((parent != NULL) && (!w->is_visible_child_of(parent)))
+                        continue;
+                    if (w->inside(x, y))
+                        return w;
+                }
+                return NULL;
+            }
+
+            lookup(&found, 0, vNodes.size(), x, y, parent);
+            return (found != NULL) ? found->pWidget : NULL;
+        }
+
+    } /* namespace tk */
+} /* namespace lsp */
@@ -85,7 +85,7 @@ namespace lsp
             sTag(&sProperties),
             sDrawMode(&sProperties)
         {
-            nFlags                  = REDRAW_SURFACE | SIZE_INVALID | RESIZE_PENDING;
+            nFlags                  = REDRAW_SURFACE | SIZE_INVALID | RESIZE_PENDING | LAYOUT_INVALID | SIZE_CHANGED;
             pClass                  = &metadata;
             pDisplay                = dpy;
             pParent                 = NULL;
@@ -102,6 +102,14 @@ namespace lsp
             sSize.nWidth            = 0;
             sSize.nHeight           = 0;
             pSurface                = NULL;
+            nSurfaceFrame           = 0;
+            pDirtyWindow            = NULL;
+            sDrawArea.nLeft         = 0;
+            sDrawArea.nTop          = 0;
+            sDrawArea.nWidth        = 0;
+            sDrawArea.nHeight       = 0;
+            nDrawSerial             = 0;
+            nParentSerial           = 0;
         }
 
         Widget::~Widget()
@@ -193,24 +201,37 @@ namespace lsp
             return (id >= 0) ? STATUS_OK : -id;
         }
 
+        status_t Widget::init_from(Widget *prototype)
+        {
+            if ((prototype == NULL) || (prototype == this) ||
+                (prototype->pClass != pClass) || (!prototype->valid()))
+                return init();
+
+            status_t res = sStyle.set_prototype(&prototype->sStyle);
+            if (res != STATUS_OK)
+                return res;
+
+            res = init();
+            sStyle.set_prototype(NULL);
+
+            return res;
+        }
+
         void Widget::do_destroy()
         {
             // Remove from parent window
             Window *wnd             = widget_cast<Window>(toplevel());
             if (wnd != NULL)
                 wnd->discard_widget(this);
+            if (pDirtyWindow != NULL)
+                pDirtyWindow->remove_dirty(this);
 
             // Set parent widget to NULL
             set_parent(NULL);
             sStyle.destroy();
 
             // Destroy surface
-            if (pSurface != NULL)
-            {
-                pSurface->destroy();
-                delete pSurface;
-                pSurface = NULL;
-            }
+            drop_surface();
 
             // Execute slots and unbind all to prevent duplicate on_destroy calls
             sSlots.execute(SLOT_DESTROY, this);
@@ -220,7 +241,11 @@ namespace lsp
         void Widget::property_changed(Property *prop)
         {
             if (prop->one_of(sScaling, sFontScaling, sPadding, sAllocation))
+            {
+                // Padding and allocation flags affect the allocation in parent widget
+                nFlags     |= SIZE_CHANGED;
                 query_resize();
+            }
             if (sBrightness.is(prop))
                 query_draw();
             if (prop->one_of(sBgBrightness, sBgColor, sBgInherit))
@@ -493,13 +518,8 @@ namespace lsp
             if (wnd != NULL)
                 wnd->discard_widget(this);
 
-            // Drop surface to not to eat memory
-            if (pSurface != NULL)
-            {
-                pSurface->destroy();
-                delete pSurface;
-                pSurface = NULL;
-            }
+            // Return surface to the pool to not to eat memory
+            drop_surface();
 
             // Execute slot
             sSlots.execute(SLOT_HIDE, this);
@@ -512,6 +532,8 @@ namespace lsp
         void Widget::show_widget()
         {
             query_resize();
+            if (pParent != NULL)
+                pParent->query_resize();
             query_draw(REDRAW_CHILD | REDRAW_SURFACE);
             sSlots.execute(SLOT_SHOW, this);
         }
@@ -567,12 +589,26 @@ namespace lsp
             if (flags == nFlags)
                 return;
 
+            // Register the widget in the list of dirty widgets of the window
+            if ((flags & (~nFlags) & REDRAW_SURFACE) && (pParent != NULL))
+            {
+                Window *wnd     = widget_cast<Window>(toplevel());
+                if (wnd != NULL)
+                    wnd->add_dirty(this);
+            }
+
             // Update flags and call parent
             nFlags      = flags;
             if (pParent != NULL)
                 pParent->query_draw(REDRAW_CHILD);
         }
 
+        void Widget::request_animation()
+        {
+            if (pDisplay != NULL)
+                pDisplay->frame_scheduler()->request_animation();
+        }
+
         void Widget::commit_redraw()
         {
             nFlags &= ~(REDRAW_SURFACE | REDRAW_CHILD);
@@ -601,13 +637,29 @@ namespace lsp
                 return;
 
             // Update flags
+            nFlags     |= (RESIZE_PENDING | SIZE_INVALID | LAYOUT_INVALID);
+
+            if (!sVisibility.get())
+                return;
+
+            if (pParent != NULL)
+                pParent->query_child_resize();
+        }
+
+        void Widget::query_child_resize()
+        {
+            if (nFlags & REALIZE_ACTIVE)
+                return;
+
+            // Size limits should be re-computed but allocation of children remains valid
+            // until some child reports the change of it's size limits
             nFlags     |= (RESIZE_PENDING | SIZE_INVALID);
 
             if (!sVisibility.get())
                 return;
 
             if (pParent != NULL)
-                pParent->query_resize();
+                pParent->query_child_resize();
         }
 
         void Widget::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
@@ -617,31 +669,50 @@ namespace lsp
             if (src == NULL)
                 return;
 
-            // Render to the main surface
-            s->clip_begin(area);
+            // Render to the main surface, the surface may be larger than the widget
+            ws::rectangle_t xr;
+            if (!Size::intersection(&xr, area, &sSize))
+                return;
+
+            s->clip_begin(&xr);
                 s->draw(src, sSize.nLeft, sSize.nTop, 1.0f, 1.0f, 0.0f);
             s->clip_end();
         }
 
+        size_t Widget::next_draw_serial()
+        {
+            static size_t draw_serial   = 0;
+            return ++draw_serial;
+        }
+
+        void Widget::render_child(Widget *child, ws::ISurface *s, const ws::rectangle_t *area, bool force)
+        {
+            // The full render of the child invalidates the areas of all its children
+            if ((force) || (child->nFlags & REDRAW_SURFACE))
+                child->nDrawSerial      = next_draw_serial();
+            child->nParentSerial    = nDrawSerial;
+            child->sDrawArea        = *area;
+
+            child->render(s, area, force);
+        }
+
         ws::ISurface *Widget::get_surface(ws::ISurface *s)
         {
-            return get_surface(s, sSize.nWidth, sSize.nHeight);
+            return get_surface(s, sSize.nWidth, sSize.nHeight, false);
         }
 
         ws::ISurface *Widget::get_surface(ws::ISurface *s, ssize_t width, ssize_t height)
         {
+            return get_surface(s, width, height, true);
+        }
+
+        ws::ISurface *Widget::get_surface(ws::ISurface *s, ssize_t width, ssize_t height, bool exact)
+        {
+            SurfacePool *pool   = pDisplay->surface_pool();
+
             // Check surface
-            if (pSurface != NULL)
-            {
-                if ((!pSurface->valid()) ||
-                    (width != ssize_t(pSurface->width())) ||
-                    (height != ssize_t(pSurface->height())))
-                {
-                    pSurface->destroy();
-                    delete pSurface;
-                    pSurface    = NULL;
-                }
-            }
+            if ((pSurface != NULL) && (!SurfacePool::fits(pSurface, width, height, exact)))
+                drop_surface();
 
             // Create new surface if needed
             if (pSurface == NULL)
@@ -653,7 +724,7 @@ namespace lsp
                 if ((width <= 0) || (height <= 0))
                     return NULL;
 
-                pSurface        = s->create(width, height);
+                pSurface        = pool->acquire(this, s, width, height, exact);
                 if (pSurface == NULL)
                 {
                     lsp_warn("Failed to create surface obj=%p, width=%d, height=%d",
@@ -662,6 +733,7 @@ namespace lsp
                 }
                 nFlags         |= REDRAW_SURFACE;
             }
+            nSurfaceFrame   = pool->frame();
 
             // Redraw surface if required
             if (nFlags & REDRAW_SURFACE)
@@ -675,6 +747,16 @@ namespace lsp
             return pSurface;
         }
 
+        void Widget::drop_surface()
+        {
+            if (pSurface == NULL)
+                return;
+
+            pDisplay->surface_pool()->release(pSurface);
+            pSurface        = NULL;
+            nFlags         |= REDRAW_SURFACE;
+        }
+
         void Widget::draw(ws::ISurface *s)
         {
         }
@@ -702,7 +784,7 @@ namespace lsp
             realize(r);
 
             // Reset size pending flags
-            nFlags     &= ~(SIZE_INVALID | RESIZE_PENDING | REALIZE_ACTIVE);
+            nFlags     &= ~(SIZE_INVALID | RESIZE_PENDING | REALIZE_ACTIVE | LAYOUT_INVALID | SIZE_CHANGED);
             query_draw();   // Always query redraw after realize()
 
             // Send Realized() event
@@ -718,6 +800,8 @@ namespace lsp
                 size_request(l);
 
                 // Store size limit and update flags
+                if (!SizeConstraints::equals(&sLimit, l))
+                    nFlags |= SIZE_CHANGED;
                 sLimit  = *l;
                 nFlags &= ~SIZE_INVALID;
             }
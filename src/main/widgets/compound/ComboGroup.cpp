@@ -527,7 +527,7 @@ namespace lsp
                 {
                     // Draw the child only if it is visible in the area
                     if (Size::intersection(&xr, &sSize))
-                        widget->render(s, &xr, force);
+                        render_child(widget, s, &xr, force);
 
                     widget->commit_redraw();
                 }
@@ -74,7 +74,9 @@ namespace lsp
             WidgetContainer(dpy),
             sHBar(dpy),
             sVBar(dpy),
+            sDataItem(dpy),
             vItems(&sProperties, &sIListener),
+            vDataItems(&sProperties),
             vSelected(&sProperties, &sIListener),
             sSizeConstraints(&sProperties),
             sHScrollMode(&sProperties),
@@ -98,7 +100,7 @@ namespace lsp
             nCurrIndex      = -1;
             nLastIndex      = -1;
             nKeyScroll      = SCR_NONE;
-            pHoverItem      = NULL;
+            nHoverIndex     = -1;
 
             sArea.nLeft     = 0;
             sArea.nTop      = 0;
@@ -142,13 +144,16 @@ namespace lsp
             vItems.flush();
             vSelected.flush();
             vVisible.flush();
+            vDataItems.flush();
 
             // Cleanup relations
             sHBar.set_parent(NULL);
             sVBar.set_parent(NULL);
+            sDataItem.set_parent(NULL);
 
             sHBar.destroy();
             sVBar.destroy();
+            sDataItem.destroy();
         }
 
         status_t ListBox::init()
@@ -161,6 +166,8 @@ namespace lsp
                 result  = sHBar.init();
             if (result == STATUS_OK)
                 result  = sVBar.init();
+            if (result == STATUS_OK)
+                result  = sDataItem.init();
             if (result != STATUS_OK)
                 return result;
 
@@ -185,6 +192,9 @@ namespace lsp
             sVBar.slots()->bind(SLOT_KEY_DOWN, slot_on_scroll_key_event, self());
             sVBar.slots()->bind(SLOT_KEY_UP, slot_on_scroll_key_event, self());
 
+            // Configure shared item for data items
+            sDataItem.set_parent(this);
+
             // Init style
             sSizeConstraints.bind("size.constraints", &sStyle);
             sHScrollMode.bind("hscroll.mode", &sStyle);
@@ -245,6 +255,12 @@ namespace lsp
 
             if (vItems.is(prop))
                 query_resize();
+            if (vDataItems.is(prop))
+            {
+                nHoverIndex     = -1;
+                vVisible.clear();
+                query_resize();
+            }
             if (vSelected.is(prop))
                 query_draw();
         }
@@ -266,23 +282,47 @@ namespace lsp
             ws::text_parameters_t tp;
             sFont.get_parameters(pDisplay, fscaling, &fp);
 
-            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            const size_t n_widgets  = vItems.size();
+            const size_t n_items    = n_widgets + vDataItems.size();
+            for (size_t i=0; i<n_items; ++i)
             {
-                // Skip invisible items
-                ListBoxItem *li = vItems.get(i);
-                if ((li == NULL) || (!li->visibility()->get()))
-                    continue;
+                ListBoxItem *li;
+                ssize_t data;
+
+                if (i < n_widgets)
+                {
+                    // Skip invisible items
+                    li              = vItems.get(i);
+                    if ((li == NULL) || (!li->visibility()->get()))
+                        continue;
+                    data            = -1;
+
+                    // Obtain the text of item
+                    s.clear();
+                    li->text()->format(&s);
+                }
+                else
+                {
+                    // Skip hidden data items, all data items share the same style
+                    data            = i - n_widgets;
+                    if (vDataItems.flags(data) & IF_HIDDEN)
+                        continue;
+                    li              = &sDataItem;
+
+                    // Obtain the text of item
+                    if (!s.set_utf8(vDataItems.text(data)))
+                        return;
+                }
 
                 // Add item to list
                 item_t *ai      = v->add();
                 if  (!ai)
                     return;
-                ai->item        = li;
+                ai->item        = (data < 0) ? li : NULL;
                 ai->index       = i;
+                ai->data        = data;
 
-                // Obtain the text of item and it's parameters
-                s.clear();
-                li->text()->format(&s);
+                // Obtain parameters of the text
                 li->text_adjust()->apply(&s);
                 sFont.get_text_parameters(pDisplay, &tp, fscaling, &s);
 
@@ -539,7 +579,8 @@ namespace lsp
                 it->r.nLeft         = xr.nLeft;
                 it->r.nTop          = xr.nTop + (spacing >> 1);
 
-                it->item->realize_widget(&it->r);
+                if (it->item != NULL)
+                    it->item->realize_widget(&it->r);
 
                 // Update position
                 xr.nTop            += it->a.nHeight + spacing;
@@ -663,23 +704,25 @@ namespace lsp
                     sFont.get_parameters(pDisplay, fscaling, &fp);
 
                     s->clip_begin(&xa);
+                    sDataItem.commit_redraw();
                     for (size_t i=0, n=vVisible.size(); i<n; ++i)
                     {
                         item_t *it = vVisible.get(i);
                         if (it == NULL)
                             continue;
-                        ListBoxItem *li = it->item;
-                        if (li == NULL)
-                            continue;
+                        ListBoxItem *li = (it->item != NULL) ? it->item : &sDataItem;
 
                         li->commit_redraw();
                         if (!Size::overlap(&xa, &it->r)) // Do not draw invisible items
                             continue;
 
                         text.clear();
-                        li->text()->format(&text);
+                        if (it->item != NULL)
+                            li->text()->format(&text);
+                        else if (!text.set_utf8(vDataItems.text(it->data)))
+                            continue;
                         li->text_adjust()->apply(&text);
-                        bool selected = vSelected.contains(li);
+                        bool selected = is_selected(it);
                         sFont.get_text_parameters(pDisplay, &tp, fscaling, &text);
 
                         if (selected)
@@ -688,7 +731,7 @@ namespace lsp
                             s->fill_rect(col, SURFMASK_NONE, 0.0f, &it->r);
                             col.copy(li->text_selected_color()->color());
                         }
-                        else if (it->item == pHoverItem)
+                        else if (ssize_t(it->index) == nHoverIndex)
                         {
                             col.copy(li->bg_hover_color()->color());
                             s->fill_rect(col, SURFMASK_NONE, 0.0f, &it->r);
@@ -696,9 +739,12 @@ namespace lsp
                         }
                         else
                         {
-                            li->get_actual_bg_color(col);
+                            // Data items may override the colors of the shared style
+                            if ((it->item != NULL) || (!vDataItems.get_bg_color(&col, it->data)))
+                                li->get_actual_bg_color(col);
                             s->fill_rect(col, SURFMASK_NONE, 0.0f, &it->r);
-                            col.copy(li->text_color()->color());
+                            if ((it->item != NULL) || (!vDataItems.get_text_color(&col, it->data)))
+                                col.copy(li->text_color()->color());
                         }
 
                         li->padding()->enter(&xr, &it->r, scaling);
@@ -718,6 +764,21 @@ namespace lsp
             if (!vSelected.values(&si))
                 return;
 
+            // Data items follow widget items, so keep the last selected data item
+            // if there is one, otherwise keep the last selected widget
+            ssize_t last    = -1;
+            for (ssize_t i = vDataItems.find_flags(IF_SELECTED); i >= 0; i = vDataItems.find_flags(IF_SELECTED, i + 1))
+                last            = i;
+
+            if (last >= 0)
+            {
+                vSelected.clear();
+                vDataItems.clear_flags(IF_SELECTED, false);
+                vDataItems.set_flags(last, vDataItems.flags(last) | IF_SELECTED, false);
+                query_draw();
+                return;
+            }
+
             // Remove all items except last one
             for (ssize_t i=0, n=si.size()-1; i<n; ++i)
             {
@@ -727,6 +788,20 @@ namespace lsp
             }
         }
 
+        void ListBox::clear_selection()
+        {
+            vSelected.clear();
+            if (vDataItems.clear_flags(IF_SELECTED, false))
+                query_draw();
+        }
+
+        bool ListBox::is_selected(const item_t *it)
+        {
+            if (it->item != NULL)
+                return vSelected.contains(it->item);
+            return vDataItems.flags(it->data) & IF_SELECTED;
+        }
+
         Widget *ListBox::find_widget(ssize_t x, ssize_t y)
         {
             if ((sHBar.is_visible_child_of(this)) && (sHBar.inside(x, y)))
@@ -816,6 +891,7 @@ namespace lsp
                 item->set_parent(self);
             }
 
+            self->nHoverIndex   = -1;
             self->vVisible.clear();
             self->query_resize();
         }
@@ -839,6 +915,7 @@ namespace lsp
                 self->unlink_widget(item);
             }
 
+            self->nHoverIndex   = -1;
             self->vVisible.clear();
             self->query_resize();
         }
@@ -889,10 +966,10 @@ namespace lsp
                     select_single(nCurrIndex, e->nState & ws::MCF_CONTROL);
             }
 
-            ListBoxItem *hover_item = (it != NULL) ? it->item : NULL;
-            if (pHoverItem != hover_item)
+            ssize_t hover   = (it != NULL) ? it->index : -1;
+            if (nHoverIndex != hover)
             {
-                pHoverItem  = hover_item;
+                nHoverIndex     = hover;
                 query_draw();
             }
 
@@ -901,9 +978,9 @@ namespace lsp
 
         status_t ListBox::on_mouse_out(const ws::event_t *e)
         {
-            if (pHoverItem != NULL)
+            if (nHoverIndex >= 0)
             {
-                pHoverItem      = NULL;
+                nHoverIndex     = -1;
                 query_draw();
             }
             return STATUS_OK;
@@ -1030,15 +1107,32 @@ namespace lsp
 
             if (!add)
             {
-                vSelected.clear();
+                clear_selection();
                 changed = true;
             }
 
             if (last < first)
                 swap(first, last);
 
+            const ssize_t n_widgets = vItems.size();
             for (; first <= last; ++first)
             {
+                if (first >= n_widgets)
+                {
+                    // Lightweight data item
+                    const ssize_t data  = first - n_widgets;
+                    if (data >= ssize_t(vDataItems.size()))
+                        break;
+                    const size_t flags  = vDataItems.flags(data);
+                    if (flags & IF_HIDDEN)
+                        continue;
+
+                    vDataItems.set_flags(data, flags | IF_SELECTED, false);
+                    query_draw();
+                    changed = true;
+                    continue;
+                }
+
                 ListBoxItem *li = vItems.get(first);
                 if ((li == NULL) || (!li->visibility()->get()))
                     continue;
@@ -1060,14 +1154,29 @@ namespace lsp
             bool changed = false;
             if ((!add) || (!sMultiSelect.get()))
             {
-                vSelected.clear();
+                clear_selection();
                 changed = true;
             }
-            ListBoxItem *it = vItems.get(index);
-            if (it != NULL)
+
+            const ssize_t n_widgets = vItems.size();
+            if (index >= n_widgets)
             {
-                vSelected.toggle(it);
-                changed = true;
+                // Lightweight data item
+                const ssize_t data  = index - n_widgets;
+                if (data < ssize_t(vDataItems.size()))
+                {
+                    vDataItems.set_flags(data, vDataItems.flags(data) ^ IF_SELECTED, false);
+                    changed = true;
+                }
+            }
+            else
+            {
+                ListBoxItem *it = vItems.get(index);
+                if (it != NULL)
+                {
+                    vSelected.toggle(it);
+                    changed = true;
+                }
             }
 
             // Execute change
@@ -1183,7 +1292,10 @@ namespace lsp
         status_t ListBox::key_scroll_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg)
         {
             ListBox *_this = widget_ptrcast<ListBox>(arg);
-            return (_this != NULL) ? _this->on_key_scroll() : STATUS_OK;
+            if (_this == NULL)
+                return STATUS_OK;
+            _this->request_animation();
+            return _this->on_key_scroll();
         }
 
         status_t ListBox::on_key_scroll()
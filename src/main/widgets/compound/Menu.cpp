@@ -288,9 +288,11 @@ namespace lsp
 
         Menu::Menu(Display *dpy):
             WidgetContainer(dpy),
+            vDataItems(&sProperties),
             sWindow(dpy, this),
             sUp(dpy, this, -1),
             sDown(dpy, this, 1),
+            sDataItem(dpy),
             sFont(&sProperties),
             sScrolling(&sProperties),
             sBorderSize(&sProperties),
@@ -371,6 +373,10 @@ namespace lsp
             sDown.set_parent(this);
             sDown.visibility()->set(false);
 
+            if ((result = sDataItem.init()) != STATUS_OK)
+                return result;
+            sDataItem.set_parent(this);
+
             // Initialize timers
             sKeyTimer.bind(pDisplay);
             sKeyTimer.set_handler(key_scroll_handler, self());
@@ -399,7 +405,10 @@ namespace lsp
             sIPadding.bind("ipadding", &sStyle);
             sSubmenu.bind(NULL);
 
-            return STATUS_OK;
+            // Bind slots
+            handler_id_t id = sSlots.add(SLOT_SUBMIT, slot_on_submit, self());
+
+            return (id >= 0) ? STATUS_OK : -id;
         }
 
         void Menu::destroy()
@@ -417,6 +426,7 @@ namespace lsp
 
             // Cleanup cached data
             vVisible.flush();
+            sHitIndex.clear();
 
             // Unlink children
             size_t n            = vItems.size();
@@ -431,6 +441,11 @@ namespace lsp
 
             // Cleanup chilren
             vItems.flush();
+            vDataItems.flush();
+
+            // Destroy shared item
+            sDataItem.set_parent(NULL);
+            sDataItem.destroy();
 
             // Destroy related window
             sWindow.destroy();
@@ -448,6 +463,9 @@ namespace lsp
 
             if (prop->one_of(sCheckDrawUnchecked, sRadioDrawUnchecked, sCheckSize, sCheckBorder, sCheckBorderGap, sCheckBorderRadius, sSpacing))
                 query_resize();
+
+            if (prop->one_of(vDataItems))
+                query_resize();
         }
 
         void Menu::size_request(ws::size_limit_t *r)
@@ -510,6 +528,17 @@ namespace lsp
             sFont.get_parameters(pDisplay, fscaling, &fp);
 
             // First pass: estimate that there are certain elements present
+            for (size_t i=0, n=vDataItems.size(); i<n; ++i)
+            {
+                // Data items may have only check boxes and radio buttons
+                size_t flags        = vDataItems.flags(i);
+                if ((!(flags & (IF_HIDDEN | IF_SEPARATOR))) && (flags & (IF_CHECK | IF_RADIO)))
+                {
+                    st->ckbox           = true;
+                    break;
+                }
+            }
+
             for (size_t i=0, n=vItems.size(); i<n; ++i)
             {
                 // Keep only visible items
@@ -545,12 +574,29 @@ namespace lsp
             ssize_t min_pad_l   = (st->ckbox)   ? st->check_w + spacing : 0;
             ssize_t min_pad_r   = (st->submenu) ? st->link_w  + spacing : 0;
 
-            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            const size_t n_widgets  = vItems.size();
+            const size_t n_items    = n_widgets + vDataItems.size();
+            for (size_t i=0; i<n_items; ++i)
             {
-                // Keep only visible items
-                MenuItem *mi        = vItems.get(i);
-                if ((mi == NULL) || (!mi->visibility()->get()))
-                    continue;
+                MenuItem *mi;
+                ssize_t data;
+
+                if (i < n_widgets)
+                {
+                    // Keep only visible items
+                    mi                  = vItems.get(i);
+                    if ((mi == NULL) || (!mi->visibility()->get()))
+                        continue;
+                    data                = -1;
+                }
+                else
+                {
+                    // Skip hidden data items, all data items share the same style
+                    data                = i - n_widgets;
+                    if (vDataItems.flags(data) & IF_HIDDEN)
+                        continue;
+                    mi                  = &sDataItem;
+                }
 
                 // Add item to list
                 item_t *pi          = out->add();
@@ -558,11 +604,12 @@ namespace lsp
                     return;
 
                 // Estimate type of item
-                menu_item_type_t mt = mi->type()->get();
+                menu_item_type_t mt = item_type(mi, data);
                 bool xsep           = (mt != MI_SEPARATOR);
 
                 // Compute padding
                 pi->item            = mi;
+                pi->data            = data;
                 mi->padding()->compute(&pi->pad, scaling);
 
                 // Reduce padding
@@ -583,7 +630,10 @@ namespace lsp
 
                 if (xsep)
                 {
-                    mi->text()->format(&caption);
+                    if (data < 0)
+                        mi->text()->format(&caption);
+                    else if (!caption.set_utf8(vDataItems.text(data)))
+                        return;
                     mi->text_adjust()->apply(&caption);
                     sFont.get_text_parameters(pDisplay, &tp, fscaling, &caption);
 
@@ -767,7 +817,7 @@ namespace lsp
                 MenuItem *mi        = pi->item;
 
                 // Estimate type of item
-                menu_item_type_t mt = mi->type()->get();
+                menu_item_type_t mt = item_type(mi, pi->data);
                 bool sep            = (mt == MI_SEPARATOR);
                 bool check          = (mt == MI_CHECK) || (mt == MI_RADIO);
 
@@ -775,9 +825,10 @@ namespace lsp
                 pi->area.nTop       = rr.nTop;
                 pi->area.nWidth     = rr.nWidth;
 
-                // Realize menu item
+                // Realize menu item, data items are not widgets
                 xr                  = pi->area;
-                pi->item->realize_widget(&xr);
+                if (pi->data < 0)
+                    pi->item->realize_widget(&xr);
 
                 // Apply padding
                 xr.nLeft           += pi->pad.nLeft;
@@ -829,6 +880,16 @@ namespace lsp
             // Remember drawing parameters
             vVisible.swap(items);
             sIStats             = st;
+
+            // Rebuild hit-test index
+            sHitIndex.clear();
+            for (size_t i=0, n=vVisible.size(); i<n; ++i)
+            {
+                item_t *pi          = vVisible.uget(i);
+                if ((pi->data < 0) && (pi->item->valid()))
+                    sHitIndex.add(pi->item);
+            }
+            sHitIndex.build();
         }
 
         void Menu::draw(ws::ISurface *s)
@@ -861,6 +922,8 @@ namespace lsp
             bool aa             = s->set_antialiasing(true);
             lsp_finally { s->set_antialiasing(aa); };
 
+            sDataItem.commit_redraw();
+
             for (ssize_t i=0, n=vVisible.size(); i<n; ++i)
             {
                 item_t *pi          = vVisible.uget(i);
@@ -876,7 +939,9 @@ namespace lsp
                 mi->commit_redraw();
 
                 // Just separator?
-                if (mi->type()->separator())
+                menu_item_type_t mt = item_type(mi, pi->data);
+                bool checked        = item_checked(mi, pi->data);
+                if (mt == MI_SEPARATOR)
                 {
                     color.copy(mi->text_color()->color());
                     color.scale_lch_luminance(bright);
@@ -891,13 +956,21 @@ namespace lsp
                     color.scale_lch_luminance(bright);
                     s->fill_rect(color, SURFMASK_NONE, 0.0f, &pi->area);
                 }
+                else if ((pi->data >= 0) && (vDataItems.get_bg_color(&color, pi->data)))
+                {
+                    color.scale_lch_luminance(bright);
+                    s->fill_rect(color, SURFMASK_NONE, 0.0f, &pi->area);
+                }
 
                 // Draw text
-                mi->text()->format(&text);
+                if (pi->data < 0)
+                    mi->text()->format(&text);
+                else if (!text.set_utf8(vDataItems.text(pi->data)))
+                    continue;
                 mi->text_adjust()->apply(&text);
                 if (nSelected == i)
                     color.copy(mi->text_selected_color()->color());
-                else
+                else if ((pi->data < 0) || (!vDataItems.get_text_color(&color, pi->data)))
                     color.copy(mi->text_color()->color());
                 color.scale_lch_luminance(bright);
                 sFont.draw(s, color, pi->text.nLeft, pi->text.nTop + fp.Ascent, fscaling, &text);
@@ -922,7 +995,7 @@ namespace lsp
                 }
 
                 // Need to draw check box/radio?
-                if ((mi->type()->check()) && ((mi->checked()->get()) || (sCheckDrawUnchecked.get())))
+                if ((mt == MI_CHECK) && ((checked) || (sCheckDrawUnchecked.get())))
                 {
                     ssize_t br          = lsp_max(0, sCheckBorderRadius.get() * scaling);
                     ssize_t bw          = (sCheckBorder.get() > 0) ? lsp_max(1, sCheckBorder.get() * scaling) : 0;
@@ -950,7 +1023,7 @@ namespace lsp
                         r.nHeight          -= bgap * 2;
                         br                  = lsp_max(0, br - bgap);
 
-                        if (mi->checked()->get())
+                        if (checked)
                         {
                             color.copy(mi->check_color()->color());
                             color.scale_lch_luminance(bright);
@@ -959,7 +1032,7 @@ namespace lsp
                     }
                     else
                     {
-                        if (mi->checked()->get())
+                        if (checked)
                             color.copy(mi->check_color()->color());
                         else
                             color.copy(mi->check_bg_color()->color());
@@ -967,7 +1040,7 @@ namespace lsp
                         s->fill_rect(color, SURFMASK_ALL_CORNER, br, &r);
                     }
                 }
-                else if ((mi->type()->radio()) && ((mi->checked()->get()) || (sRadioDrawUnchecked.get())))
+                else if ((mt == MI_RADIO) && ((checked) || (sRadioDrawUnchecked.get())))
                 {
                     float br            = pi->check.nWidth * 0.5f;
                     float xc            = pi->check.nLeft + br;
@@ -987,7 +1060,7 @@ namespace lsp
                         s->fill_circle(color, xc, yc, br);
                         br                  = lsp_max(0, br - bgap);
 
-                        if (mi->checked()->get())
+                        if (checked)
                         {
                             color.copy(mi->check_color()->color());
                             color.scale_lch_luminance(bright);
@@ -996,7 +1069,7 @@ namespace lsp
                     }
                     else
                     {
-                        if (mi->checked()->get())
+                        if (checked)
                             color.copy(mi->check_color()->color());
                         else
                             color.copy(mi->check_bg_color()->color());
@@ -1248,13 +1321,7 @@ namespace lsp
             if ((sDown.is_visible_child_of(this)) && (sDown.inside(x, y)))
                 return &sDown;
 
-            for (size_t i=0, n=vVisible.size(); i<n; ++i)
-            {
-                item_t *pi = vVisible.uget(i);
-                if ((pi->item->valid()) && (pi->item->inside(x, y)))
-                    return pi->item;
-            }
-            return NULL;
+            return sHitIndex.find(x, y, NULL);
         }
 
         void Menu::select_menu_item(MenuItem *item, bool popup)
@@ -1290,7 +1357,7 @@ namespace lsp
             if (popup)
             {
                 item_t *it = (sel >= 0) ? vVisible.uget(sel) : NULL;
-                MenuItem *item = it->item;
+                MenuItem *item = (it != NULL) ? it->item : NULL;
                 Menu *cmenu = (item != NULL) ? item->menu()->get() : NULL;
                 if (cmenu != NULL)
                     show_submenu(cmenu, item);
@@ -1309,7 +1376,7 @@ namespace lsp
             for (size_t i=0, n=vVisible.size(); i<n; ++i)
             {
                 item_t *pi = vVisible.uget(i);
-                if ((pi->item != NULL) && (!pi->item->type()->separator()))
+                if ((pi->item != NULL) && (item_type(pi->item, pi->data) != MI_SEPARATOR))
                 {
                     sel = i;
                     break;
@@ -1425,6 +1492,7 @@ namespace lsp
         status_t Menu::on_key_up(const ws::event_t *e)
         {
             MenuItem *submit = NULL;
+            ssize_t data     = -1;
 
             // Analyze key code
             switch (e->nCode)
@@ -1440,7 +1508,10 @@ namespace lsp
                 case ws::WSK_KEYPAD_ENTER:
                 {
                     item_t *pi      = (nSelected >= 0) ? vVisible.get(nSelected) : NULL;
-                    submit          = (pi != NULL) ? pi->item : NULL;
+                    if ((pi != NULL) && (pi->data >= 0))
+                        data            = pi->data;
+                    else
+                        submit          = (pi != NULL) ? pi->item : NULL;
 
                     nKeyScroll      = 0;
                     break;
@@ -1463,7 +1534,7 @@ namespace lsp
                 {
                     item_t *item = (nSelected >= 0) ? vVisible.get(nSelected) : NULL;
                     MenuItem *sel = (item != NULL) ? item->item : NULL;
-                    Menu *child = ((sel != NULL) && (!sel->type()->separator())) ? sel->menu()->get() : NULL;
+                    Menu *child = ((sel != NULL) && (item->data < 0) && (!sel->type()->separator())) ? sel->menu()->get() : NULL;
                     if (child != NULL)
                     {
                         show_submenu(child, sel);
@@ -1495,6 +1566,8 @@ namespace lsp
                 submit_menu_item(submit, true);
                 submit->slots()->execute(SLOT_SUBMIT, submit);
             }
+            else if (data >= 0)
+                submit_data_item(data);
 
             return STATUS_OK;
         }
@@ -1502,13 +1575,19 @@ namespace lsp
         status_t Menu::key_scroll_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg)
         {
             Menu *m = widget_ptrcast<Menu>(arg);
-            return (m != NULL) ? m->handle_key_scroll(m->nKeyScroll) : STATUS_OK;
+            if (m == NULL)
+                return STATUS_OK;
+            m->request_animation();
+            return m->handle_key_scroll(m->nKeyScroll);
         }
 
         status_t Menu::mouse_scroll_handler(ws::timestamp_t sched, ws::timestamp_t time, void *arg)
         {
             Menu *m = widget_ptrcast<Menu>(arg);
-            return (m != NULL) ? m->handle_mouse_scroll(m->nMouseScroll) : STATUS_OK;
+            if (m == NULL)
+                return STATUS_OK;
+            m->request_animation();
+            return m->handle_mouse_scroll(m->nMouseScroll);
         }
 
         status_t Menu::handle_key_scroll(ssize_t dir)
@@ -1532,7 +1611,7 @@ namespace lsp
 
                 // Get item
                 pi  = vVisible.uget(pos);
-                if (!pi->item->type()->separator())
+                if (item_type(pi->item, pi->data) != MI_SEPARATOR)
                     break;
             }
 
@@ -1542,8 +1621,9 @@ namespace lsp
 
             // Position has altered
             nSelected = pos;
-            pi->item->take_focus();
-            sync_scroll(pi->item);
+            if (pi->data < 0)
+                pi->item->take_focus();
+            sync_scroll(&pi->area);
             query_draw();
 
             return STATUS_OK;
@@ -1566,6 +1646,13 @@ namespace lsp
         }
 
         void Menu::sync_scroll(MenuItem *item)
+        {
+            ws::rectangle_t wr;
+            item->get_rectangle(&wr);
+            sync_scroll(&wr);
+        }
+
+        void Menu::sync_scroll(const ws::rectangle_t *area)
         {
             float scaling       = lsp_max(0.0f, sScaling.get());
             ssize_t scroll      = lsp_max(0, sScrolling.get() * scaling);
@@ -1593,12 +1680,10 @@ namespace lsp
                 bottom              = wr.nTop;
             }
 
-            item->get_rectangle(&wr);
-
-            if (wr.nTop < top)
-                new_scroll         -= top - wr.nTop;
-            else if ((wr.nTop + wr.nHeight) > bottom)
-                new_scroll         += wr.nTop + wr.nHeight - bottom;
+            if (area->nTop < top)
+                new_scroll         -= top - area->nTop;
+            else if ((area->nTop + area->nHeight) > bottom)
+                new_scroll         += area->nTop + area->nHeight - bottom;
 
             // Limit scrolling and update
             new_scroll          = lsp_limit(new_scroll, 0, sIStats.max_scroll);
@@ -1620,6 +1705,108 @@ namespace lsp
             return STATUS_OK;
         }
 
+        menu_item_type_t Menu::item_type(MenuItem *mi, ssize_t data)
+        {
+            if (data < 0)
+                return mi->type()->get();
+
+            size_t flags = vDataItems.flags(data);
+            if (flags & IF_SEPARATOR)
+                return MI_SEPARATOR;
+            if (flags & IF_CHECK)
+                return MI_CHECK;
+            if (flags & IF_RADIO)
+                return MI_RADIO;
+            return MI_NORMAL;
+        }
+
+        bool Menu::item_checked(MenuItem *mi, ssize_t data)
+        {
+            if (data < 0)
+                return mi->checked()->get();
+            return vDataItems.flags(data) & IF_CHECKED;
+        }
+
+        ssize_t Menu::find_item(ssize_t x, ssize_t y)
+        {
+            if (vVisible.is_empty())
+                return -1;
+
+            // Since all items have sorted order from top to bottom, perform binary search
+            ssize_t first = 0, last = vVisible.size() - 1, middle;
+            while (first <= last)
+            {
+                middle          = (first + last) >> 1;
+                item_t *pi      = vVisible.uget(middle);
+
+                if (y < pi->area.nTop)
+                    last  = middle - 1;
+                else if (y >= (pi->area.nTop + pi->area.nHeight))
+                    first = middle + 1;
+                else
+                    return (Position::inside(&pi->area, x, y)) ? middle : -1;
+            }
+
+            return -1;
+        }
+
+        void Menu::submit_data_item(ssize_t data)
+        {
+            // Data items have no submenus, the whole menu is hidden
+            submit_menu_item(NULL, false);
+            sSlots.execute(SLOT_SUBMIT, this, &data);
+        }
+
+        status_t Menu::on_mouse_in(const ws::event_t *e)
+        {
+            return on_mouse_move(e);
+        }
+
+        status_t Menu::on_mouse_move(const ws::event_t *e)
+        {
+            // Widget items handle mouse events by themselves
+            ssize_t sel = find_item(e->nLeft, e->nTop);
+            item_t *pi  = (sel >= 0) ? vVisible.uget(sel) : NULL;
+            if ((pi == NULL) || (pi->data < 0) || (sel == nSelected))
+                return STATUS_OK;
+            if (item_type(pi->item, pi->data) == MI_SEPARATOR)
+                return STATUS_OK;
+
+            select_menu_item(sel, true);
+            return STATUS_OK;
+        }
+
+        status_t Menu::on_mouse_up(const ws::event_t *e)
+        {
+            // Allow only left button click
+            if ((e->nCode != ws::MCB_LEFT) || ((e->nState & ws::MCF_BTN_MASK) != ws::MCF_LEFT))
+                return STATUS_OK;
+
+            ssize_t sel = find_item(e->nLeft, e->nTop);
+            item_t *pi  = (sel >= 0) ? vVisible.uget(sel) : NULL;
+            if ((pi == NULL) || (pi->data < 0))
+                return STATUS_OK;
+            if (item_type(pi->item, pi->data) == MI_SEPARATOR)
+                return STATUS_OK;
+
+            submit_data_item(pi->data);
+            return STATUS_OK;
+        }
+
+        status_t Menu::slot_on_submit(Widget *sender, void *ptr, void *data)
+        {
+            Menu *_this = widget_ptrcast<Menu>(ptr);
+            if (_this == NULL)
+                return STATUS_BAD_ARGUMENTS;
+            const ssize_t *index = static_cast<const ssize_t *>(data);
+            return (index != NULL) ? _this->on_submit(*index) : STATUS_OK;
+        }
+
+        status_t Menu::on_submit(ssize_t index)
+        {
+            return STATUS_OK;
+        }
+
         bool Menu::set_tether(const lltl::darray<tether_t> *list)
         {
             return sWindow.set_tether(list);
@@ -69,6 +69,7 @@ namespace lsp
         {
             nMFlags         = 0;
             nState          = 0;
+            bHorizontal     = true;
 
             pClass          = &metadata;
         }
@@ -207,26 +208,49 @@ namespace lsp
             return STATUS_OK;
         }
 
+        ssize_t Box::find_cell(ssize_t x, ssize_t y)
+        {
+            // Cells are sorted along the box orientation and do not overlap,
+            // so the binary search gives the only candidate
+            ssize_t v       = (bHorizontal) ? x : y;
+            ssize_t first   = 0, last = ssize_t(vVisible.size()) - 1, found = -1;
+
+            while (first <= last)
+            {
+                ssize_t mid     = (first + last) >> 1;
+                cell_t *w       = vVisible.uget(mid);
+                ssize_t start   = (bHorizontal) ? w->a.nLeft : w->a.nTop;
+                if (start <= v)
+                {
+                    found           = mid;
+                    first           = mid + 1;
+                }
+                else
+                    last            = mid - 1;
+            }
+
+            return found;
+        }
+
         Widget *Box::find_widget(ssize_t x, ssize_t y)
         {
             // Do not search for any widget
             if (sSolid.get())
                 return NULL;
 
-            for (size_t i=0, n=vVisible.size(); i<n; ++i)
-            {
-                cell_t *w = vVisible.uget(i);
-                Widget *pw = w->pWidget;
+            ssize_t idx = find_cell(x, y);
+            if (idx < 0)
+                return NULL;
 
-                if ((pw == NULL) || (!pw->is_visible_child_of(this)))
-                    continue;
-                if (!pw->visibility()->get())
-                    continue;
-                if (pw->inside(x, y))
-                    return pw;
-            }
+            cell_t *w = vVisible.uget(idx);
+            Widget *pw = w->pWidget;
+
+            if ((pw == NULL) || (!pw->is_visible_child_of(this)))
+                return NULL;
+            if (!pw->visibility()->get())
+                return NULL;
 
-            return NULL;
+            return (pw->inside(x, y)) ? pw : NULL;
         }
 
         void Box::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
@@ -275,7 +299,7 @@ namespace lsp
                 if ((force) || (w->redraw_pending()))
                 {
                     if (Size::intersection(&xr, area, &wc->s))
-                        w->render(s, &xr, force);
+                        render_child(w, s, &xr, force);
                     w->commit_redraw();
                 }
 
@@ -694,6 +718,11 @@ namespace lsp
                 w->s.nHeight    = xh;
                 w->pWidget->padding()->enter(&w->s, w->pWidget->scaling()->get());
 
+                // Do not realize the widget if it's area did not change and it has nothing to update
+                w->pWidget->get_rectangle(&r);
+                if ((Size::equals(&r, &w->s)) && (!w->pWidget->resize_pending()))
+                    continue;
+
                 // Realize the widget
 //                lsp_trace("realize child=%p, id=%d, parameters = {%d, %d, %d, %d}",
 //                        w->pWidget, int(i), int(w->s.nLeft), int(w->s.nTop), int(w->s.nWidth), int(w->s.nHeight));
@@ -701,8 +730,43 @@ namespace lsp
             }
         }
 
+        bool Box::allocation_valid(const ws::rectangle_t *r)
+        {
+            ws::size_limit_t sr;
+
+            // The allocation becomes invalid if the box has been resized, it's properties
+            // or the set of visible children have changed
+            if (nFlags & LAYOUT_INVALID)
+                return false;
+            if (!Size::equals(&sSize, r))
+                return false;
+
+            // Check that size limits of children did not change
+            for (size_t i=0, n=vVisible.size(); i<n; ++i)
+            {
+                cell_t *w       = vVisible.uget(i);
+                w->pWidget->get_padded_size_limits(&sr);
+                if (w->pWidget->size_changed())
+                    return false;
+            }
+
+            return true;
+        }
+
         void Box::realize(const ws::rectangle_t *r)
         {
+            // Re-use previous allocation and realize only children that requested resize
+            if (allocation_valid(r))
+            {
+                for (size_t i=0, n=vVisible.size(); i<n; ++i)
+                {
+                    cell_t *w       = vVisible.uget(i);
+                    if (w->pWidget->resize_pending())
+                        w->pWidget->realize_widget(&w->s);
+                }
+                return;
+            }
+
             // Flush previously visible widgets
             vVisible.flush();
 
@@ -734,6 +798,7 @@ namespace lsp
             {
                 realize_children(visible);
                 vVisible.swap(&visible);
+                bHorizontal     = sOrientation.horizontal();
             }
         }
 
@@ -77,6 +77,8 @@ namespace lsp
         {
             // Cleanup cached data
             free_cells(&sAlloc);
+            vColPos.flush();
+            vRowPos.flush();
 
             // Unlink children
             for (size_t i=0, n=vItems.size(); i<n; ++i)
@@ -190,19 +192,59 @@ namespace lsp
             return !w->pWidget->visibility()->get();
         }
 
+        ssize_t Grid::find_position(lltl::darray<ssize_t> *pos, ssize_t value)
+        {
+            // Find the last row or column that starts before the value
+            ssize_t first = 0, last = ssize_t(pos->size()) - 1, found = -1;
+            while (first <= last)
+            {
+                ssize_t mid     = (first + last) >> 1;
+                if (*(pos->uget(mid)) <= value)
+                {
+                    found           = mid;
+                    first           = mid + 1;
+                }
+                else
+                    last            = mid - 1;
+            }
+
+            return found;
+        }
+
         Widget *Grid::find_widget(ssize_t x, ssize_t y)
         {
-            for (size_t i=0, n=sAlloc.vCells.size(); i<n; ++i)
+            // Scan all cells if the index of rows and columns is not built
+            if ((vColPos.size() != sAlloc.nCols) || (vRowPos.size() != sAlloc.nRows))
             {
-                cell_t *w = sAlloc.vCells.uget(i);
-                Widget *pw = w->pWidget;
-                if ((pw == NULL) || (!pw->is_visible_child_of(this)))
-                    continue;
-                if (pw->inside(x, y))
-                    return pw;
+                for (size_t i=0, n=sAlloc.vCells.size(); i<n; ++i)
+                {
+                    cell_t *w = sAlloc.vCells.uget(i);
+                    Widget *pw = w->pWidget;
+                    if ((pw == NULL) || (!pw->is_visible_child_of(this)))
+                        continue;
+                    if (pw->inside(x, y))
+                        return pw;
+                }
+
+                return NULL;
             }
 
-            return NULL;
+            // Lookup the cell in the table by row and column
+
+            ssize_t col = find_position(&vColPos, x);
+            ssize_t row = find_position(&vRowPos, y);
+            if ((col < 0) || (row < 0))
+                return NULL;
+
+            cell_t *w = sAlloc.vTable.get(row * sAlloc.nCols + col);
+            if (w == NULL)
+                return NULL;
+
+            Widget *pw = w->pWidget;
+            if ((pw == NULL) || (!pw->is_visible_child_of(this)))
+                return NULL;
+
+            return (pw->inside(x, y)) ? pw : NULL;
         }
 
         void Grid::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
@@ -254,7 +296,7 @@ namespace lsp
                 if ((force) || (w->pWidget->redraw_pending()))
                 {
                     if (Size::intersection(&xr, area, &w->s))
-                        w->pWidget->render(s, &xr, force);
+                        render_child(w->pWidget, s, &xr, force);
                     w->pWidget->commit_redraw();
                 }
 
@@ -377,6 +419,7 @@ namespace lsp
 
                     free_cells(&sAlloc);
                     unlink_widget(widget);
+                    query_resize();
                     return STATUS_OK;
                 }
             }
@@ -395,13 +438,56 @@ namespace lsp
 
             free_cells(&sAlloc);
             vItems.flush();
+            query_resize();
 
             return STATUS_OK;
         }
 
+        bool Grid::allocation_valid(const ws::rectangle_t *r)
+        {
+            ws::size_limit_t sr;
+
+            // The allocation becomes invalid if the grid has been resized, it's properties
+            // or the set of visible children have changed
+            if (nFlags & LAYOUT_INVALID)
+                return false;
+            if (!Size::equals(&sSize, r))
+                return false;
+
+            // Check that size limits of children did not change
+            for (size_t i=0, n=sAlloc.vCells.size(); i<n; ++i)
+            {
+                cell_t *w       = sAlloc.vCells.uget(i);
+                if ((w->pWidget == NULL) || (!w->pWidget->visibility()->get()))
+                    continue;
+
+                w->pWidget->get_padded_size_limits(&sr);
+                if (w->pWidget->size_changed())
+                    return false;
+            }
+
+            return true;
+        }
+
         void Grid::realize(const ws::rectangle_t *r)
         {
+            // Re-use previous allocation tables and realize only children that requested resize
+            if (allocation_valid(r))
+            {
+                for (size_t i=0, n=sAlloc.vCells.size(); i<n; ++i)
+                {
+                    cell_t *w       = sAlloc.vCells.uget(i);
+                    if ((w->pWidget == NULL) || (!w->pWidget->visibility()->get()))
+                        continue;
+                    if (w->pWidget->resize_pending())
+                        w->pWidget->realize_widget(&w->s);
+                }
+                return;
+            }
+
             free_cells(&sAlloc);
+            vColPos.flush();
+            vRowPos.flush();
 
 //            lsp_trace("this=%p, size={%d, %d, %d, %d}",
 //                    this, int(r->nLeft), int(r->nTop), int(r->nWidth), int(r->nHeight)
@@ -433,6 +519,14 @@ namespace lsp
             sAlloc.nRows    = a.nRows;
             sAlloc.nCols    = a.nCols;
 
+            // Build hit-testing index
+            if ((build_positions(&vColPos, &sAlloc.vCols, r->nLeft) != STATUS_OK) ||
+                (build_positions(&vRowPos, &sAlloc.vRows, r->nTop) != STATUS_OK))
+            {
+                vColPos.flush();
+                vRowPos.flush();
+            }
+
             // Call parent method to realize
             WidgetContainer::realize(r);
 
@@ -1104,6 +1198,24 @@ namespace lsp
             }
         }
 
+        status_t Grid::build_positions(lltl::darray<ssize_t> *pos, lltl::darray<header_t> *vh, ssize_t start)
+        {
+            size_t n        = vh->size();
+            ssize_t *v      = pos->add_n(n);
+            if ((v == NULL) && (n > 0))
+                return STATUS_NO_MEM;
+
+            // Same coordinates as computed by assign_coords()
+            for (size_t i=0; i<n; ++i)
+            {
+                header_t *h     = vh->uget(i);
+                v[i]            = start;
+                start          += h->nSize + h->nSpacing;
+            }
+
+            return STATUS_OK;
+        }
+
         void Grid::realize_children(alloc_t *a)
         {
             ws::size_limit_t sr;
@@ -1131,6 +1243,11 @@ namespace lsp
                 w->s.nHeight    = xh;
                 w->pWidget->padding()->enter(&w->s, w->pWidget->scaling()->get());
 
+                // Do not realize the widget if it's area did not change and it has nothing to update
+                w->pWidget->get_rectangle(&r);
+                if ((Size::equals(&r, &w->s)) && (!w->pWidget->resize_pending()))
+                    continue;
+
                 // Realize the widget
 //                lsp_trace("realize widget %p, id=%d, allocation = {%d, %d, %d, %d}, size = {%d, %d, %d, %d}",
 //                        w->pWidget, int(i),
@@ -355,7 +355,7 @@ namespace lsp
                 if ((force) || (pWidget->redraw_pending()))
                 {
                     if (Size::intersection(&xr, &sSize))
-                        pWidget->render(s, &xr, force);
+                        render_child(pWidget, s, &xr, force);
                     pWidget->commit_redraw();
                 }
 
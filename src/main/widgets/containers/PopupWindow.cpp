@@ -115,10 +115,6 @@ namespace lsp
 
         status_t PopupWindow::post_init()
         {
-            // Bind redraw handler
-            sRedraw.bind(pDisplay->display());
-            sRedraw.set_handler(tmr_redraw_request, self());
-
             // Don't create native window
             return STATUS_OK;
         }
@@ -158,11 +154,17 @@ namespace lsp
 
             Window::hide_widget();
 
-            // Destroy window
+            // Destroy window, the hide event won't be delivered after that
+            if (bMapped)
+            {
+                bMapped     = false;
+                drop_surface();
+                pDisplay->frame_scheduler()->remove(this);
+            }
+            // Return the native window to the pool
             if (pWindow != NULL)
             {
-                pWindow->destroy();
-                delete pWindow;
+                pDisplay->window_pool()->release(pWindow);
                 pWindow = NULL;
             }
         }
@@ -197,31 +199,24 @@ namespace lsp
             if ((screen < 0) || (screen >= ssize_t(dpy->screens())))
                 screen      = dpy->default_screen();
 
-            // Destroy the window if it does not match requirements
+            // Return the window to the pool if it does not match requirements
+            WindowPool *pool    = pDisplay->window_pool();
             if ((pWindow != NULL) && (pWindow->screen() != size_t(screen)))
             {
-                pWindow->destroy();
-                delete pWindow;
+                pool->release(pWindow);
                 pWindow = NULL;
             }
 
-            // Now we are ready to create window
+            // Now we are ready to borrow the window from the pool
             ws::IWindow *wnd = pWindow;
             if (wnd == NULL)
             {
-                // Create window
-                wnd = dpy->create_window(screen);
-                if (wnd == NULL)
-                    return false;
+                ws::size_limit_t sr;
+                get_padded_size_limits(&sr);
 
-                // Initialize window
-                status_t result = wnd->init();
-                if (result != STATUS_OK)
-                {
-                    wnd->destroy();
-                    delete wnd;
+                wnd = pool->acquire(screen, sr.nMinWidth, sr.nMinHeight);
+                if (wnd == NULL)
                     return false;
-                }
 
                 wnd->set_handler(this);
                 wnd->set_border_style(sBorderStyle.get());
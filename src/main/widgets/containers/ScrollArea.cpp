@@ -394,7 +394,7 @@ namespace lsp
                 // Draw the child only if it is visible in the area
                 pWidget->get_rectangle(&xr);
                 if (Size::intersection(&xr, &xa))
-                    pWidget->render(s, &xr, force);
+                    render_child(pWidget, s, &xr, force);
 
                 pWidget->commit_redraw();
             }
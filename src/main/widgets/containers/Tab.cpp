@@ -229,7 +229,7 @@ namespace lsp
                 ws::rectangle_t xr;
                 pWidget->get_rectangle(&xr);
                 if (Size::intersection(&xr, area))
-                    pWidget->render(s, &xr, force);
+                    render_child(pWidget, s, &xr, force);
 
                 pWidget->commit_redraw();
             }
@@ -49,6 +49,7 @@ namespace lsp
                 sHeadingFill.bind("heading.fill", this);
                 sHeadingSpacingFill.bind("heading.spacing.fill", this);
                 sAggregateSize.bind("size.aggregate", this);
+                sLazySize.bind("size.lazy", this);
                 sTabPointer.bind("tab.pointer", this);
 
                 // Configure
@@ -69,6 +70,7 @@ namespace lsp
                 sHeadingFill.set(true);
                 sHeadingSpacingFill.set(true);
                 sAggregateSize.set(true);
+                sLazySize.set(false);
             LSP_TK_STYLE_IMPL_END
 
             LSP_TK_BUILTIN_STYLE(TabControl, "TabControl", "root");
@@ -97,6 +99,7 @@ namespace lsp
             sHeadingFill(&sProperties),
             sHeadingSpacingFill(&sProperties),
             sAggregateSize(&sProperties),
+            sLazySize(&sProperties),
             sTabPointer(&sProperties),
             vWidgets(&sProperties, &sIListener),
             sSelected(&sProperties)
@@ -173,6 +176,7 @@ namespace lsp
             sTabJoint.bind("tab.joint", &sStyle);
             sHeadingFill.bind("heading.fill", &sStyle);
             sAggregateSize.bind("size.aggregate", &sStyle);
+            sLazySize.bind("size.lazy", &sStyle);
             sHeadingSpacingFill.bind("heading.spacing.fill", &sStyle);
             sTabPointer.bind("tab.pointer", &sStyle);
 
@@ -205,6 +209,7 @@ namespace lsp
 
             // Cleanup collections
             vWidgets.flush();
+            vLimits.flush();
         }
 
         void TabControl::property_changed(Property *prop)
@@ -219,6 +224,8 @@ namespace lsp
                 query_resize();
             if (prop->one_of(sTabJoint, sHeadingFill, sHeadingSpacingFill))
                 query_draw();
+            if (prop->one_of(sAggregateSize, sLazySize))
+                query_resize();
             if (vWidgets.is(prop))
                 query_resize();
             if (sSelected.is(prop))
@@ -333,13 +340,31 @@ namespace lsp
             // Estimate the size of the area for the widget
             if (sAggregateSize.get())
             {
+                bool lazy       = sLazySize.get();
+                tk::Tab *ct     = current_tab();
+
                 // Compute the aggregate size for all tabs
                 for (size_t i=0, n=vWidgets.size(); i<n; ++i)
                 {
                     tk::Tab *w = vWidgets.get(i);
                     if ((w != NULL) && (w->is_visible_child_of(this)))
                     {
-                        w->get_padded_size_limits(r);
+                        if (!lazy)
+                            w->get_padded_size_limits(r);
+                        else if (w == ct)
+                        {
+                            // Request size of the selected tab and remember it
+                            w->get_padded_size_limits(r);
+                            commit_limit(w, r);
+                        }
+                        else
+                        {
+                            // Use size limits cached when the tab was selected last time
+                            limit_t *l  = find_limit(w);
+                            if (l == NULL)
+                                continue;
+                            *r          = l->limit;
+                        }
 
                         if (r->nMinWidth > 0)
                             w_area.nWidth       = lsp_max(w_area.nWidth,  ssize_t(r->nMinWidth + padding.nLeft + padding.nRight));
@@ -495,7 +520,7 @@ namespace lsp
                 if ((force) || (ct->redraw_pending()))
                 {
                     if (Size::intersection(&xr, &sArea))
-                        ct->render(s, &xr, force);
+                        render_child(ct, s, &xr, force);
                     ct->commit_redraw();
                 }
 
@@ -816,6 +841,42 @@ namespace lsp
             return STATUS_OK;
         }
 
+        TabControl::limit_t *TabControl::find_limit(const tk::Tab *tab)
+        {
+            for (size_t i=0, n=vLimits.size(); i<n; ++i)
+            {
+                limit_t *l = vLimits.uget(i);
+                if (l->widget == tab)
+                    return l;
+            }
+            return NULL;
+        }
+
+        void TabControl::commit_limit(tk::Tab *tab, const ws::size_limit_t *limit)
+        {
+            limit_t *l = find_limit(tab);
+            if (l == NULL)
+            {
+                if ((l = vLimits.add()) == NULL)
+                    return;
+                l->widget   = tab;
+            }
+            l->limit    = *limit;
+        }
+
+        void TabControl::forget_limit(const tk::Tab *tab)
+        {
+            for (size_t i=0, n=vLimits.size(); i<n; ++i)
+            {
+                limit_t *l = vLimits.uget(i);
+                if (l->widget == tab)
+                {
+                    vLimits.remove(i);
+                    return;
+                }
+            }
+        }
+
         tk::Tab *TabControl::current_tab()
         {
             tk::Tab *it     = sSelected.get();
@@ -1053,6 +1114,7 @@ namespace lsp
                 self->pEventTab       = NULL;
 
             self->vVisible.flush();
+            self->forget_limit(widget_ptrcast<Tab>(item));
             self->unlink_widget(item);
             self->query_resize();
         }
@@ -43,6 +43,7 @@ namespace lsp
                 sConstraints.bind("size.constraints", this);
                 sLayout.bind("layout", this);
                 sPolicy.bind("policy", this);
+                sEventCoalescing.bind("event.coalescing", this);
                 // Configure
                 sBorderColor.set("#000000");
                 sBorderStyle.set(ws::BS_SIZEABLE);
@@ -54,6 +55,7 @@ namespace lsp
                 sConstraints.set(-1, -1, -1, -1);
                 sLayout.set(0.0f, 0.0f, 0.0f, 0.0f);
                 sPolicy.set(WP_NORMAL);
+                sEventCoalescing.set(false);
                 // Override
                 sVisibility.set(false);
                 // Commit
@@ -77,7 +79,8 @@ namespace lsp
             sWindowSize(&sProperties),
             sSizeConstraints(&sProperties),
             sLayout(&sProperties),
-            sPolicy(&sProperties)
+            sPolicy(&sProperties),
+            sEventCoalescing(&sProperties)
         {
             lsp_trace("native_handle = %p", handle);
 
@@ -87,6 +90,8 @@ namespace lsp
             pNativeHandle   = handle;
             bMapped         = false;
             bOverridePointer= false;
+            bTitlePending   = true;
+            bRolePending    = true;
             fScaling        = 1.0f;
             pActor          = NULL;
 
@@ -97,6 +102,12 @@ namespace lsp
 
             hKeys.pWidget   = NULL;
 
+            ws::init_event(&hDeferred.sEvent);
+            hDeferred.nCount    = 0;
+
+            reset_event_stats();
+            reset_render_stats();
+
             pClass          = &metadata;
         }
 
@@ -144,6 +155,7 @@ namespace lsp
             sSizeConstraints.bind("size.constraints", &sStyle);
             sLayout.bind("layout", &sStyle);
             sPolicy.bind("policy", &sStyle);
+            sEventCoalescing.bind("event.coalescing", &sStyle);
 
             // Cache the actual scaling factor
             fScaling    = sScaling.get();
@@ -158,10 +170,6 @@ namespace lsp
             if (pWindow != NULL)
                 pWindow->set_handler(this);
 
-            // Bind redraw handler
-            sRedraw.bind(dpy);
-            sRedraw.set_handler(tmr_redraw_request, self());
-
             lsp_trace("Window has been initialized");
 
             if (sVisibility.get())
@@ -259,6 +267,14 @@ namespace lsp
         {
             hMouse.pWidget      = NULL;
             hKeys.pWidget       = NULL;
+            hDeferred.nCount    = 0;
+            clear_dirty();
+
+            if (bMapped)
+            {
+                bMapped             = false;
+                pDisplay->frame_scheduler()->remove(this);
+            }
 
             if (pChild != NULL)
             {
@@ -281,13 +297,28 @@ namespace lsp
             WidgetContainer::destroy();
         }
 
-        status_t Window::tmr_redraw_request(ws::timestamp_t sched, ws::timestamp_t ts, void *args)
+        void Window::request_frame()
         {
-            if (args == NULL)
-                return STATUS_BAD_ARGUMENTS;
+            if (bMapped)
+                pDisplay->frame_scheduler()->request_frame();
+        }
 
-            Window *_this   = widget_ptrcast<Window>(args);
-            return (_this != NULL) ? _this->do_render() : STATUS_BAD_ARGUMENTS;
+        void Window::query_draw(size_t flags)
+        {
+            WidgetContainer::query_draw(flags);
+            request_frame();
+        }
+
+        void Window::query_resize()
+        {
+            WidgetContainer::query_resize();
+            request_frame();
+        }
+
+        void Window::query_child_resize()
+        {
+            WidgetContainer::query_child_resize();
+            request_frame();
         }
 
         status_t Window::slot_window_close(Widget *sender, void *ptr, void *data)
@@ -315,7 +346,9 @@ namespace lsp
             if (s == NULL)
                 return STATUS_OK;
 
-            size_t flags = nFlags;
+            // The whole tree is rendered only if the back buffer is dirty or has been re-created
+            ws::ISurface *old   = pSurface;
+            bool force          = nFlags & REDRAW_SURFACE;
 
 //        #ifdef LSP_TRACE
 //            system::time_millis_t time = system::get_time_millis();
@@ -326,6 +359,7 @@ namespace lsp
                 ws::ISurface *bs = get_surface(s);
                 if (bs != NULL)
                 {
+                    force           = (force) || (bs != old);
                     bs->begin();
                     {
                         ws::rectangle_t xr;
@@ -333,7 +367,7 @@ namespace lsp
                         xr.nTop     = 0;
                         xr.nWidth   = sSize.nWidth;
                         xr.nHeight  = sSize.nHeight;
-                        render(bs, &xr, flags);
+                        render(bs, &xr, force);
                     }
                     bs->end();
 
@@ -405,11 +439,118 @@ namespace lsp
             return res;
         }
 
+        void Window::add_dirty(Widget *w)
+        {
+            if (w->pDirtyWindow == this)
+                return;
+            if (w->pDirtyWindow != NULL)
+                w->pDirtyWindow->remove_dirty(w);
+            if (vDirty.add(w))
+                w->pDirtyWindow     = this;
+        }
+
+        void Window::remove_dirty(Widget *w)
+        {
+            if (w->pDirtyWindow != this)
+                return;
+            vDirty.premove(w);
+            w->pDirtyWindow     = NULL;
+        }
+
+        void Window::clear_dirty()
+        {
+            for (size_t i=0, n=vDirty.size(); i<n; ++i)
+                vDirty.uget(i)->pDirtyWindow    = NULL;
+            vDirty.clear();
+        }
+
+        Widget *Window::dirty_root(Widget *w)
+        {
+            Widget *root    = w;
+
+            for (Widget *p = w; p != this; p = p->pParent)
+            {
+                // The widget has been removed from the window
+                Widget *parent  = p->pParent;
+                if (parent == NULL)
+                    return NULL;
+
+                // The dirty surface of the container covers all its children
+                if (p->nFlags & REDRAW_SURFACE)
+                    root            = p;
+
+                // The widget is hidden or has not been rendered by the parent since the last
+                // full render of the parent, so only the parent knows how to render it
+                if ((!p->sVisibility.get()) ||
+                    (p->nParentSerial == 0) ||
+                    (p->nParentSerial != parent->nDrawSerial))
+                    root            = parent;
+            }
+
+            return root;
+        }
+
+        bool Window::render_dirty(ws::ISurface *s)
+        {
+            // Find the widgets to render
+            lltl::parray<Widget> roots;
+            for (size_t i=0, n=vDirty.size(); i<n; ++i)
+            {
+                Widget *w       = vDirty.uget(i);
+                if (!w->redraw_pending())
+                    continue;
+
+                Widget *root    = dirty_root(w);
+                if (root == NULL)
+                    continue;
+                if ((root == this) || (!roots.add(root)))
+                    return false;
+            }
+
+            // Render widgets using the area passed by their parents at the last render
+            for (size_t i=0, n=roots.size(); i<n; ++i)
+            {
+                Widget *w       = roots.uget(i);
+                if (!w->redraw_pending())
+                    continue;
+
+                ws::rectangle_t xr  = w->sDrawArea;
+                w->pParent->render_child(w, s, &xr, false);
+                w->commit_redraw();
+                ++sRenderStats.nDirty;
+            }
+
+            // Commit redraw of containers on the paths to rendered widgets
+            for (size_t i=0, n=roots.size(); i<n; ++i)
+            {
+                for (Widget *p = roots.uget(i)->pParent; (p != NULL) && (p != this); p = p->pParent)
+                {
+                    if (!p->redraw_pending())
+                        break;
+                    p->commit_redraw();
+                }
+            }
+
+            return true;
+        }
+
         void Window::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
         {
             if (!bMapped)
                 return;
 
+            // Visit only dirty widgets and containers on their paths if possible
+            if (force)
+                nDrawSerial     = next_draw_serial();
+            else if (render_dirty(s))
+            {
+                clear_dirty();
+                ++sRenderStats.nPartial;
+                return;
+            }
+            clear_dirty();
+            ++sRenderStats.nFull;
+
             lsp::Color bg_color;
             get_actual_bg_color(bg_color);
 
@@ -425,7 +566,7 @@ namespace lsp
                 ws::rectangle_t xr;
                 pChild->get_padded_rectangle(&xr);
                 if (Size::intersection(&xr, area))
-                    pChild->render(s, &xr, force);
+                    render_child(pChild, s, &xr, force);
 
                 pChild->commit_redraw();
             }
@@ -492,6 +633,36 @@ namespace lsp
             return (mp == pWindow->get_mouse_pointer()) ? STATUS_OK : pWindow->set_mouse_pointer(mp);
         }
 
+        status_t Window::update_title()
+        {
+            if ((!bTitlePending) || (pWindow == NULL))
+                return STATUS_OK;
+
+            // Make formatted title of the window
+            LSPString text;
+            status_t res = sTitle.format(&text);
+            if (res != STATUS_OK)
+                return res;
+
+            bTitlePending   = false;
+            return pWindow->set_caption(&text);
+        }
+
+        status_t Window::update_role()
+        {
+            if ((!bRolePending) || (pWindow == NULL))
+                return STATUS_OK;
+
+            // Make formatted role of the window
+            LSPString text;
+            status_t res = sRole.format(&text);
+            if (res != STATUS_OK)
+                return res;
+
+            bRolePending    = false;
+            return pWindow->set_role(text.get_utf8());
+        }
+
         void Window::property_changed(Property *prop)
         {
             WidgetContainer::property_changed(prop);
@@ -503,20 +674,17 @@ namespace lsp
                 update_pointer();
             if (sTitle.is(prop))
             {
-                // Make formatted title of the window
-                LSPString text;
-                status_t res = sTitle.format(&text);
-                if (res == STATUS_OK)
-                    pWindow->set_caption(&text);
+                // Format the title only if the window is visible, otherwise defer until it is shown
+                bTitlePending   = true;
+                if (sVisibility.get())
+                    update_title();
             }
             if (sRole.is(prop))
             {
-                // Make formatted title of the window
-                LSPString text;
-                status_t res = sRole.format(&text);
-                if (res != STATUS_OK)
-                    return;
-                pWindow->set_role(text.get_utf8());
+                // Format the role only if the window is visible, otherwise defer until it is shown
+                bRolePending    = true;
+                if (sVisibility.get())
+                    update_role();
             }
             if (sPadding.is(prop))
                 query_resize();
@@ -569,6 +737,8 @@ namespace lsp
             }
             if (sPolicy.is(prop) || sScaling.is(prop))
                 query_resize();
+            if (sEventCoalescing.is(prop) && (!sEventCoalescing.get()))
+                flush_events();
         }
 
         status_t Window::grab_events(ws::grab_t grab)
@@ -598,6 +768,8 @@ namespace lsp
             // Update window parameters
             if (pWindow != NULL)
             {
+                update_title();
+                update_role();
                 sync_size(false);
                 update_pointer();
             }
@@ -730,11 +902,104 @@ namespace lsp
             return hKeys.vKeys.size();
         }
 
+        bool Window::defer_event(const ws::event_t *e)
+        {
+            ws::event_t *de     = &hDeferred.sEvent;
+
+            switch (e->nType)
+            {
+                case ws::UIE_MOUSE_MOVE:
+                    if (hDeferred.nCount > 0)
+                    {
+                        // Motion can be merged only with motion of the same button state
+                        if ((de->nType != e->nType) || (de->nState != e->nState))
+                            return false;
+                        ++sEventStats.nMotionMerged;
+                    }
+
+                    // Only the final position matters
+                    *de                 = *e;
+                    hDeferred.nCount    = 1;
+                    return true;
+
+                default:
+                    break;
+            }
+
+            return false;
+        }
+
+        status_t Window::flush_events()
+        {
+            if (hDeferred.nCount <= 0)
+                return STATUS_OK;
+
+            ws::event_t ev      = hDeferred.sEvent;
+            hDeferred.nCount    = 0;
+
+            return dispatch_event(&ev);
+        }
+
+        void Window::get_event_stats(event_stats_t *stats) const
+        {
+            *stats              = sEventStats;
+        }
+
+        void Window::reset_event_stats()
+        {
+            sEventStats.nReceived       = 0;
+            sEventStats.nDispatched     = 0;
+            sEventStats.nMotionMerged   = 0;
+        }
+
+        void Window::get_render_stats(render_stats_t *stats) const
+        {
+            *stats              = sRenderStats;
+        }
+
+        void Window::reset_render_stats()
+        {
+            sRenderStats.nFull          = 0;
+            sRenderStats.nPartial       = 0;
+            sRenderStats.nDirty         = 0;
+        }
+
         status_t Window::handle_event(const ws::event_t *e)
+        {
+            ++sEventStats.nReceived;
+
+            if (sEventCoalescing.get())
+            {
+                // Try to merge event with the deferred one, it will be delivered with the next frame
+                if (defer_event(e))
+                {
+                    request_frame();
+                    return STATUS_OK;
+                }
+
+                // Deliver the deferred event first to preserve the order of events
+                status_t res        = flush_events();
+                if (res != STATUS_OK)
+                    return res;
+                if (defer_event(e))
+                {
+                    request_frame();
+                    return STATUS_OK;
+                }
+            }
+            else if (hDeferred.nCount > 0)
+                flush_events();
+
+            return dispatch_event(e);
+        }
+
+        status_t Window::dispatch_event(const ws::event_t *e)
         {
             status_t result = STATUS_OK;
             ws::event_t ev = *e;
 
+            ++sEventStats.nDispatched;
+
             switch (e->nType)
             {
                 //-------------------------------------------------------------
@@ -744,7 +1009,7 @@ namespace lsp
                     if (!bMapped)
                     {
                         bMapped     = true;
-                        sRedraw.launch(-1, 40);
+                        pDisplay->frame_scheduler()->add(this);
                         query_draw(REDRAW_SURFACE);
                     }
                     sVisibility.commit_value(true);
@@ -755,13 +1020,8 @@ namespace lsp
                     if (bMapped)
                     {
                         bMapped     = false;
-                        if (pSurface != NULL)
-                        {
-                            pSurface->destroy();
-                            delete pSurface;
-                            pSurface = NULL;
-                        }
-                        sRedraw.cancel();
+                        drop_surface();
+                        pDisplay->frame_scheduler()->remove(this);
                     }
                     sVisibility.commit_value(false);
                     break;
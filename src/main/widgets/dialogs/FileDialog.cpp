@@ -1440,7 +1440,9 @@ namespace lsp
             if (!sVisibility.get())
                 return STATUS_OK;
 
-            sWFiles.selected()->clear();
+            // Only the selection changes, do not force the relayout of the list
+            if (sWFiles.data_items()->clear_flags(IF_SELECTED, false))
+                sWFiles.query_draw();
             status_t res = apply_filters();
 
             LSP_STATUS_ASSERT(sSelected.set_raw(""));
@@ -2336,10 +2338,11 @@ namespace lsp
 
         FileDialog::f_entry_t *FileDialog::selected_entry()
         {
-            ListBoxItem *item = sWFiles.selected()->any();
-            if (item == NULL)
+            ItemList *items = sWFiles.data_items();
+            ssize_t index   = items->find_flags(IF_SELECTED);
+            if (index < 0)
                 return NULL;
-            ssize_t index = item->tag()->get();
+            index           = items->tag(index);
             if (index < 0)
                 return NULL;
             return vFiles.get(index);
@@ -2407,7 +2410,8 @@ namespace lsp
             }
             else
             {
-                sWFiles.selected()->clear();
+                if (sWFiles.data_items()->clear_flags(IF_SELECTED, false))
+                    sWFiles.query_draw();
                 LSP_STATUS_ASSERT(sWSearch.text()->format(&xfname));
             }
 
@@ -2418,9 +2422,10 @@ namespace lsp
                 fmask            = (tag >= 0) ? sFilter.get(tag) : NULL;
             }
 
-            // Now we need to fill data
-            WidgetList<ListBoxItem> *lst = sWFiles.items();
-            lst->clear();
+            // Now we need to fill data, lightweight data items are used for file entries
+            // since the directory may contain thousands of files
+            prop::ItemList lst;
+            LSP_STATUS_ASSERT(lst.reserve(vFiles.size()));
             float xs = sWFiles.hscroll()->get(), ys = sWFiles.vscroll()->get(); // Remember scroll values
 
             // Process files
@@ -2443,10 +2448,7 @@ namespace lsp
                 if (ent->nFlags & (F_ISOTHER | F_ISDIR | F_ISLINK | F_ISINVALID))
                 {
                     if (!tmp.set(psrc))
-                    {
-                        lst->clear();
                         return STATUS_NO_MEM;
-                    }
                     psrc = &tmp;
 
                     // Modify the name of the item
@@ -2463,44 +2465,31 @@ namespace lsp
                     }
 
                     if (!ok)
-                    {
-                        lst->clear();
                         return STATUS_NO_MEM;
-                    }
-                }
-
-                // Add item
-                ListBoxItem *item = new ListBoxItem(pDisplay);
-                if (item == NULL)
-                    return STATUS_NO_MEM;
-
-                if ((res = item->init()) != STATUS_OK)
-                {
-                    delete item;
-                    return res;
-                }
-                item->text()->set_raw(psrc);
-                item->tag()->set(i);
-                if ((res = lst->madd(item)) != STATUS_OK)
-                {
-                    delete item;
-                    return res;
                 }
 
                 // Check if is equal
+                size_t flags = 0;
                 if ((!(ent->nFlags & (F_ISDIR | F_DOTDOT))) && (xfname.length() > 0))
                 {
 //                    lsp_trace("  %s <-> %s", ent->sName.get_native(), xfname.get_native());
                     #ifdef PLATFORM_WINDOWS
                     if (ent->sName.equals_nocase(&xfname))
-                        sWFiles.selected()->add(item);
+                        flags      |= IF_SELECTED;
                     #else
                     if (ent->sName.equals(&xfname))
-                        sWFiles.selected()->add(item);
+                        flags      |= IF_SELECTED;
                     #endif /* PLATFORM_WINDOWS */
                 }
+
+                // Add item
+                if ((res = lst.add(psrc, i, flags)) != STATUS_OK)
+                    return res;
             }
 
+            // Commit the list of items
+            sWFiles.data_items()->swap(&lst);
+
             // Restore scroll values
             sWFiles.hscroll()->set(xs);
             sWFiles.vscroll()->set(ys);
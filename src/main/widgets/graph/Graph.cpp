@@ -23,6 +23,7 @@
 #include <lsp-plug.in/tk/helpers/draw.h>
 #include <lsp-plug.in/stdlib/math.h>
 #include <lsp-plug.in/common/debug.h>
+#include <lsp-plug.in/dsp/dsp.h>
 #include <lsp-plug.in/lltl/ptrset.h>
 #include <private/tk/style/BuiltinStyle.h>
 
@@ -74,6 +75,8 @@ namespace lsp
             sIPadding(&sProperties)
         {
             pGlass              = NULL;
+            pStatic             = NULL;
+            bStaticValid        = false;
 
             sCanvas.nLeft       = 0;
             sCanvas.nTop        = 0;
@@ -83,6 +86,9 @@ namespace lsp
             sICanvas.nTop       = 0;
             sICanvas.nWidth     = 0;
             sICanvas.nHeight    = 0;
+            nLayout             = 0;
+
+            reset_draw_list_stats();
 
             pClass              = &metadata;
         }
@@ -112,9 +118,11 @@ namespace lsp
                 unlink_widget(item);
             }
 
-            // Destroy glass
+            // Destroy glass and static layer
             drop_glass();
+            drop_static();
 
+            vDiscarded.flush();
             vItems.flush();
             vAxis.flush();
             vBasis.flush();
@@ -131,6 +139,35 @@ namespace lsp
             }
         }
 
+        void Graph::drop_static()
+        {
+            bStaticValid = false;
+            if (pStatic != NULL)
+            {
+                pStatic->destroy();
+                delete pStatic;
+                pStatic = NULL;
+            }
+        }
+
+        void Graph::query_static_draw()
+        {
+            bStaticValid = false;
+            ++nLayout;
+            query_draw(REDRAW_SURFACE);
+        }
+
+        void Graph::get_draw_list_stats(draw_list_stats_t *stats) const
+        {
+            *stats              = sListStats;
+        }
+
+        void Graph::reset_draw_list_stats()
+        {
+            sListStats.nRecorded        = 0;
+            sListStats.nReplayed        = 0;
+        }
+
         status_t Graph::init()
         {
             status_t result = WidgetContainer::init();
@@ -157,6 +194,11 @@ namespace lsp
         void Graph::property_changed(Property *prop)
         {
             WidgetContainer::property_changed(prop);
+
+            // Any change of the graph affects the static layer and the layout of items
+            bStaticValid    = false;
+            ++nLayout;
+
             if (vItems.is(prop))
                 query_draw();
 
@@ -234,6 +276,8 @@ namespace lsp
             sICanvas.nHeight= sCanvas.nHeight;
 
             sIPadding.enter(&sICanvas, scaling);
+            bStaticValid    = false;
+            ++nLayout;
 
             for (size_t i=0, n = vItems.size(); i<n; ++i)
             {
@@ -253,6 +297,7 @@ namespace lsp
         {
             WidgetContainer::hide_widget();
             drop_glass();
+            drop_static();
         }
 
         void Graph::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
@@ -334,73 +379,148 @@ namespace lsp
             return diff;
         }
 
-        void Graph::draw(ws::ISurface *s)
+        void Graph::compute_discarded(ws::ISurface *s)
         {
-            // Clear canvas
-            lsp::Color c(sColor);
-            // c.set_rgb24(0x888888);
-            c.scale_lch_luminance(sBrightness.get());
-            s->clear(c);
+            lltl::darray<w_alloc_t> grouped;
+            vDiscarded.clear();
 
-            // Sync internal lists of axes and origins
-            sync_lists();
+            // Fill all grouped widgets
+            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            {
+                GraphItem *gi = vItems.get(i);
+                if ((gi == NULL) || (!gi->visibility()->get()))
+                    continue;
+
+                // Fill the widget allocation
+                w_alloc_t wa;
+                wa.nGroup = gi->priority_group()->get();
+                if (wa.nGroup < 0)
+                    continue;
+                if (!gi->bound_box(s, &wa.sRect))
+                    continue;
+
+                wa.nPriority = gi->priority()->get();
+                wa.pWidget   = gi;
 
-            // Compute list of discarded widgets
-            lltl::ptrset<GraphItem> discarded;
+                grouped.add(&wa);
+            }
+            grouped.qsort(compare_walloc);
+
+            // Scan for conflicting widgets and discard some widgets according to priority
+            for (size_t i=0, n=grouped.size(); i<n; ++i)
             {
-                lltl::darray<w_alloc_t> grouped;
+                w_alloc_t *wa = grouped.uget(i);
+                if (wa == NULL)
+                    continue;
 
-                // Fill all grouped widgets
-                for (size_t i=0, n=vItems.size(); i<n; ++i)
+                for (size_t j=0; j<i; ++j)
                 {
-                    GraphItem *gi = vItems.get(i);
-                    if ((gi == NULL) || (!gi->visibility()->get()))
+                    w_alloc_t *wb = grouped.uget(j);
+                    if (wb == NULL)
                         continue;
 
-                    // Fill the widget allocation
-                    w_alloc_t wa;
-                    wa.nGroup = gi->priority_group()->get();
-                    if (wa.nGroup < 0)
-                        continue;
-                    if (!gi->bound_box(s, &wa.sRect))
-                        continue;
+                    if (check_collision(wb, wa) > 0)
+                    {
+                        vDiscarded.put(wa->pWidget);
+                        break;
+                    }
+                }
+            }
+        }
 
-                    wa.nPriority = gi->priority()->get();
-                    wa.pWidget   = gi;
+        ws::ISurface *Graph::render_static(ws::ISurface *s, size_t count, const lsp::Color &c)
+        {
+            // Re-create the layer if the size of canvas has changed
+            if ((pStatic != NULL) &&
+                ((pStatic->width() != s->width()) || (pStatic->height() != s->height())))
+                drop_static();
 
-                    grouped.add(&wa);
-                }
-                grouped.qsort(compare_walloc);
+            if (pStatic == NULL)
+            {
+                pStatic = s->create(s->width(), s->height());
+                if (pStatic == NULL)
+                    return NULL;
+                bStaticValid    = false;
+            }
+            if (bStaticValid)
+                return pStatic;
+
+            // Render static items to the layer
+            pStatic->begin();
+            {
+                pStatic->clear(c);
 
-                // Scan for conflicting widgets and discard some widgets according to priority
-                for (size_t i=0, n=grouped.size(); i<n; ++i)
+                for (size_t i=0; i<count; ++i)
                 {
-                    w_alloc_t *wa = grouped.uget(i);
-                    if (wa == NULL)
+                    GraphItem *gi = vItems.get(i);
+                    if ((gi == NULL) || (!gi->visibility()->get()))
+                        continue;
+                    if (vDiscarded.contains(gi))
                         continue;
 
-                    for (size_t j=0; j<i; ++j)
-                    {
-                        w_alloc_t *wb = grouped.uget(j);
-                        if (wb == NULL)
-                            continue;
-
-                        if (check_collision(wb, wa) > 0)
-                        {
-                            discarded.put(wa->pWidget);
-                            break;
-                        }
-                    }
+                    gi->render(pStatic, &sICanvas, true);
+                    gi->commit_redraw();
                 }
             }
+            pStatic->end();
 
-            // Draw all objects
-            for (size_t i=0, n=vItems.size(); i<n; ++i)
+            bStaticValid    = true;
+            return pStatic;
+        }
+
+        void Graph::draw(ws::ISurface *s)
+        {
+            lsp::Color c(sColor);
+            // c.set_rgb24(0x888888);
+            c.scale_lch_luminance(sBrightness.get());
+
+            // Sync internal lists of axes and origins
+            sync_lists();
+
+            // Find the leading sequence of static items. Only this sequence can be cached
+            // in the static layer without breaking the drawing order of items.
+            size_t n_items  = vItems.size();
+            size_t n_static = n_items;
+            bool dyn_groups = false;
+            for (size_t i=0; i<n_items; ++i)
             {
                 GraphItem *gi = vItems.get(i);
                 if ((gi == NULL) || (!gi->visibility()->get()))
                     continue;
-                if (discarded.contains(gi))
+                if (gi->static_layer()->get())
+                    continue;
+
+                n_static        = lsp_min(n_static, i);
+                if (gi->priority_group()->get() >= 0)
+                    dyn_groups      = true;
+            }
+
+            // Compute list of discarded widgets, collisions of static items can change
+            // only when the static layer becomes invalid
+            if ((!bStaticValid) || (dyn_groups))
+                compute_discarded(s);
+
+            // Draw the static layer or clear canvas
+            size_t first    = 0;
+            ws::ISurface *st= (n_static > 0) ? render_static(s, n_static, c) : NULL;
+            if (st != NULL)
+            {
+                s->draw(st, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f);
+                first           = n_static;
+            }
+            else
+            {
+                drop_static();
+                s->clear(c);
+            }
+
+            // Draw all dynamic objects
+            for (size_t i=first; i<n_items; ++i)
+            {
+                GraphItem *gi = vItems.get(i);
+                if ((gi == NULL) || (!gi->visibility()->get()))
+                    continue;
+                if (vDiscarded.contains(gi))
                     continue;
 
                 gi->render(s, &sICanvas, true);
@@ -614,5 +734,28 @@ namespace lsp
 
             return STATUS_OK;
         }
+
+        status_t Graph::axis_to_xy(size_t index, float *x, float *y, const float *value, size_t count)
+        {
+            // Find the axis and the origin
+            tk::GraphAxis *ax = axis(index);
+            if (ax == NULL)
+                return STATUS_NOT_FOUND;
+            tk::GraphOrigin *o = origin(ax->origin()->get());
+            if (o == NULL)
+                return STATUS_NOT_FOUND;
+
+            float xx = 0, yy = 0;
+            if (!origin(o, &xx, &yy))
+                return STATUS_NOT_FOUND;
+
+            // Translate all points at once
+            dsp::fill(x, xx, count);
+            dsp::fill(y, yy, count);
+            if (!ax->apply(x, y, value, count))
+                return STATUS_NOT_FOUND;
+
+            return STATUS_OK;
+        }
     } /* namespace tk */
 } /* namespace lsp */
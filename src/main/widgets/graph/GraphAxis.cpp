@@ -54,12 +54,23 @@ namespace lsp
                 sLength.set(-1.0f);
                 sOrigin.set(0);
                 sColor.set("#ffffff");
+                // Override
+                sStaticLayer.set(true);
+                // Commit
+                sStaticLayer.override();
             LSP_TK_STYLE_IMPL_END
             LSP_TK_BUILTIN_STYLE(GraphAxis, "GraphAxis", "root");
         }
 
         const w_class_t GraphAxis::metadata             = { "GraphAxis", &GraphItem::metadata };
 
+        static size_t next_transform_version()
+        {
+            // Versions are unique across all axes, so a re-created axis never matches a stale cache
+            static size_t transform_version = 0;
+            return ++transform_version;
+        }
+
         GraphAxis::GraphAxis(Display *dpy):
             GraphItem(dpy),
             sDirection(&sProperties),
@@ -73,6 +84,10 @@ namespace lsp
             sOrigin(&sProperties),
             sColor(&sProperties)
         {
+            sTransform.bValid   = false;
+            sTransform.bEnabled = false;
+            sTransform.nVersion = 0;
+
             pClass              = &metadata;
         }
 
@@ -108,6 +123,9 @@ namespace lsp
         {
             GraphItem::property_changed(prop);
 
+            if (prop->one_of(sMin, sMax, sZero, sLogScale, sDirection, sLength))
+                sTransform.bValid   = false;
+
             if (prop->one_of(sMin, sMax, sZero))
                 query_draw();
             if (prop->one_of(sBasis, sOrigin, sDirection))
@@ -126,6 +144,11 @@ namespace lsp
             Graph *cv = graph();
             if (cv == NULL)
                 return;
+            if (replay_draw_list(cv, s))
+                return;
+
+            DisplayList *dl = begin_draw_list(cv);
+            lsp_finally { end_draw_list(cv, s); };
 
             // Prepare palette
             float scaling = lsp_max(0.0f, sScaling.get());
@@ -141,54 +164,70 @@ namespace lsp
             if (!locate_line2d(sDirection.dx(), -sDirection.dy(), cx, cy, la, lb, lc))
                 return;
 
-            bool aa = s->set_antialiasing(sSmooth.get());
-            s->parametric_line(
+            dl->set_antialiasing(sSmooth.get());
+            dl->parametric_line(
                 color,
                 la, lb, lc,
                 cv->canvas_left(), cv->canvas_right(), cv->canvas_bottom(), cv->canvas_top(),
                 width);
-            s->set_antialiasing(aa);
         }
 
-        bool GraphAxis::apply(float *x, float *y, const float *dv, size_t count)
+        const GraphAxis::transform_t *GraphAxis::transform()
         {
             // Get graph
             Graph *cv = graph();
             if (cv == NULL)
-                return false;
+                return NULL;
 
             float cx    = 0.0f, cy = 0.0f;
-            float fdx   = sDirection.dx(), fdy = -sDirection.dy();
             cv->origin(sOrigin.get(), &cx, &cy);
 
+            // Check that cached transform is still actual
+            transform_t *t  = &sTransform;
+            if ((t->bValid) &&
+                (t->fCX == cx) && (t->fCY == cy) &&
+                (t->nLeft == cv->canvas_left()) && (t->nRight == cv->canvas_right()) &&
+                (t->nTop == cv->canvas_top()) && (t->nBottom == cv->canvas_bottom()))
+                return (t->bEnabled) ? t : NULL;
+
+            t->bValid   = true;
+            t->bEnabled = false;
+            t->nVersion = next_transform_version();
+            t->nLeft    = cv->canvas_left();
+            t->nTop     = cv->canvas_top();
+            t->nRight   = cv->canvas_right();
+            t->nBottom  = cv->canvas_bottom();
+            t->fCX      = cx;
+            t->fCY      = cy;
+            t->fDX      = sDirection.dx();
+            t->fDY      = -sDirection.dy();
+            t->bLog     = sLogScale.get();
+
+            // Compute the length of the axis
             float d     = sLength.get();
             if (d < 0.0f)
             {
                 float la, lb, lc;
-
-                if (!locate_line2d(fdx, fdy, cx, cy, la, lb, lc))
-                    return false;
+                if (!locate_line2d(t->fDX, t->fDY, cx, cy, la, lb, lc))
+                    return NULL;
 
                 float x1, y1, x2, y2;
-
                 if (!clip_line2d_eq(
                         la, lb, lc,
-                        cv->canvas_left(), cv->canvas_right(), cv->canvas_bottom(), cv->canvas_top(),
+                        t->nLeft, t->nRight, t->nBottom, t->nTop,
                         2.0f,
-                        x1, y1, x2, y2
-                        )
+                        x1, y1, x2, y2)
                     )
-                    return false;
+                    return NULL;
 
                 float d1    = distance2d(cx, cy, x1, y1);
                 float d2    = distance2d(cx, cy, x2, y2);
                 d           = (d1 > d2) ? d1 : d2;
             }
-//            if (d > 1.0f)
-//                d          -= 0.5f; // Fix rounding errors
+            t->fLength  = d;
 
-            // Now we can surely apply deltas
-            if (sLogScale.get())
+            // Compute the normalizing factors
+            if (t->bLog)
             {
                 float a_min = fabsf(sMin.get());
                 float a_max = fabsf(sMax.get());
@@ -199,12 +238,11 @@ namespace lsp
                     a_max   = 1e-10f;
                 float norm = (a_min > a_max) ? logf(a_min / a_max) : logf(a_max / a_min);
                 if (norm == 0.0f)
-                    return false;
-
-                norm            = d / norm;
-                a_min           = 1.0f / a_min;
+                    return NULL;
 
-                dsp::axis_apply_log2(x, y, dv, a_min, norm * fdx, norm * fdy, count);
+                t->fZero    = 1.0f / a_min;
+                t->fNorm    = norm;
+                t->fLow     = (a_min > a_max) ? a_max : a_min;
             }
             else
             {
@@ -214,12 +252,38 @@ namespace lsp
 
                 float norm = (a_min > a_max) ? a_min : a_max;
                 if (norm == 0.0f)
-                    return false;
-                norm    = d / norm;
+                    return NULL;
+
+                t->fZero    = zero;
+                t->fNorm    = norm;
+                t->fLow     = (a_min > a_max) ? a_max : a_min;
+            }
+
+            t->bEnabled = true;
+            return t;
+        }
 
+        size_t GraphAxis::transform_version()
+        {
+            const transform_t *t = transform();
+            return (t != NULL) ? t->nVersion : 0;
+        }
+
+        bool GraphAxis::apply(float *x, float *y, const float *dv, size_t count)
+        {
+            const transform_t *t = transform();
+            if (t == NULL)
+                return false;
+
+            // Now we can surely apply deltas
+            float norm  = t->fLength / t->fNorm;
+            if (t->bLog)
+                dsp::axis_apply_log2(x, y, dv, t->fZero, norm * t->fDX, norm * t->fDY, count);
+            else
+            {
                 // Apply delta-vector
-                dsp::axis_apply_lin1(x, dv, zero, norm * fdx, count);
-                dsp::axis_apply_lin1(y, dv, zero, norm * fdy, count);
+                dsp::axis_apply_lin1(x, dv, t->fZero, norm * t->fDX, count);
+                dsp::axis_apply_lin1(y, dv, t->fZero, norm * t->fDY, count);
             }
 
             // Saturate values
@@ -231,73 +295,41 @@ namespace lsp
 
         float GraphAxis::project(float x, float y)
         {
-            // Get graph
-            Graph *cv = graph();
-            if (cv == NULL)
-                return sMin.get();
-
-            // Get the center of coordinates
-            float cx    = 0.0f, cy = 0.0f;
-            float fdx   = sDirection.dx(), fdy = -sDirection.dy();
-            cv->origin(sOrigin.get(), &cx, &cy);
-
-            // Calculate the difference relative to the center and the projection vector length
-            float dx    = x - cx, dy = y - cy;
-            float pv    = dx*fdx + dy*fdy;
-
-            float d     = sLength.get();
-            if (d < 0.0f)
-            {
-                // Now prepare the image of the line
-                float la, lb, lc;
-                if (!locate_line2d(fdx, fdy, cx, cy, la, lb, lc))
-                    return sMin.get();
+            float v;
+            return (project(&v, &x, &y, 1)) ? v : sMin.get();
+        }
 
-                float x1, y1, x2, y2;
-                if (!clip_line2d_eq(
-                        la, lb, lc,
-                        cv->canvas_left(), cv->canvas_right(), cv->canvas_bottom(), cv->canvas_top(),
-                        2.0f,
-                        x1, y1, x2, y2)
-                    )
-                    return sMin.get();
+        bool GraphAxis::project(float *v, const float *x, const float *y, size_t count)
+        {
+            const transform_t *t = transform();
+            if (t == NULL)
+                return false;
 
-                float d1    = distance2d(cx, cy, x1, y1);
-                float d2    = distance2d(cx, cy, x2, y2);
-                d           = (d1 > d2) ? d1 : d2;
-            }
+            float d     = t->fLength;
             if (d > 1.0f)
                 d          -= 0.5f; // Fix rounding errors
 
-            // Now we can surely apply deltas
-            if (sLogScale.get())
+            // Calculate the difference relative to the center and the projection vector length
+            float k     = t->fNorm / d;
+            if (t->bLog)
             {
-                float a_min = fabsf(sMin.get()), a_max = fabsf(sMax.get());
-
-                if (a_min <= 0.0f)
-                    a_min   = 1e-10f;
-                if (a_max <= 0.0f)
-                    a_max   = 1e-10f;
-                float norm = (a_min > a_max) ? logf(a_min / a_max) : logf(a_max / a_min);
-                if (norm == 0.0f)
-                    return sMin.get();
-
-                return expf(pv * norm / d) * ((a_min > a_max) ? a_max : a_min);
+                for (size_t i=0; i<count; ++i)
+                {
+                    float pv    = (x[i] - t->fCX) * t->fDX + (y[i] - t->fCY) * t->fDY;
+                    v[i]        = expf(pv * k) * t->fLow;
+                }
             }
             else
             {
-                float zero  = - sZero.get();
-                float a_min = fabsf(sMin.get() + zero);
-                float a_max = fabsf(sMax.get() + zero);
-
-                float norm = (a_min > a_max) ? a_min : a_max;
-                if (norm == 0.0f)
-                    return sMin.get();
-
-                return (pv*norm/d) - zero + ((a_min > a_max) ? a_max : a_min);
+                float shift = t->fLow - t->fZero;
+                for (size_t i=0; i<count; ++i)
+                {
+                    float pv    = (x[i] - t->fCX) * t->fDX + (y[i] - t->fCY) * t->fDY;
+                    v[i]        = pv * k + shift;
+                }
             }
 
-            return sMin.get();
+            return true;
         }
 
         bool GraphAxis::parallel(float x, float y, float &a, float &b, float &c)
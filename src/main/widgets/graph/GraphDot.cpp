@@ -246,6 +246,11 @@ namespace lsp
             Graph *cv = graph();
             if (cv == NULL)
                 return;
+            if (replay_draw_list(cv, s))
+                return;
+
+            DisplayList *dl = begin_draw_list(cv);
+            lsp_finally { end_draw_list(cv, s); };
 
             // Generate palette
             float scaling   = lsp_max(0.0f, sScaling.get());
@@ -284,7 +289,7 @@ namespace lsp
             float fpad      = ((border > 0) && (pad > 0)) ? lsp_max(1.0f, pad * scaling) : 0.0f;
             float fborder   = (border > 0) ? lsp_max(1.0f, border * scaling) : 0.0f;
 
-            bool aa         = s->set_antialiasing(true);
+            dl->set_antialiasing(true);
 
             if (border > 0)
             {
@@ -293,32 +298,29 @@ namespace lsp
                 gcol.scale_lch_luminance(bright);
 
                 // Draw border
-                ws::IGradient *gr   = s->radial_gradient(x, y, x, y, radius);
-                if (gr != NULL)
+                ssize_t gr      = dl->radial_gradient(x, y, x, y, radius);
+                if (gr >= 0)
                 {
-                    gr->add_color(0.0f, gcol);
-                    gr->add_color(1.0f, gcol, 1.0f);
-                    s->fill_circle(gr, x, y, radius);
-                    delete gr;
+                    dl->add_color(gr, 0.0f, gcol);
+                    dl->add_color(gr, 1.0f, gcol, 1.0f);
+                    dl->fill_circle(gr, x, y, radius);
                 }
 
                 // Draw padding
                 if (pad > 0)
                 {
-                    s->set_antialiasing(sSmooth.get());
                     lsp::Color hole((nXFlags & F_HIGHLIGHT) ? sHoverGapColor : sGapColor);
                     hole.scale_lch_luminance(bright);
-                    s->set_antialiasing(sSmooth.get());
-                    s->fill_circle(hole, x, y, fpad + fdot);
+                    dl->set_antialiasing(sSmooth.get());
+                    dl->fill_circle(hole, x, y, fpad + fdot);
                 }
             }
 
             // Draw the inner contents
             lsp::Color color((nXFlags & F_HIGHLIGHT) ? sHoverColor : sColor);
             color.scale_lch_luminance(bright);
-            s->set_antialiasing(sSmooth.get());
-            s->fill_circle(color, x, y, fdot);
-            s->set_antialiasing(aa);
+            dl->set_antialiasing(sSmooth.get());
+            dl->fill_circle(color, x, y, fdot);
         }
 
         status_t GraphDot::slot_on_change(Widget *sender, void *ptr, void *data)
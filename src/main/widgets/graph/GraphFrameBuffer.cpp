@@ -24,6 +24,9 @@
 #include <lsp-plug.in/dsp/dsp.h>
 #include <private/tk/style/BuiltinStyle.h>
 
+#define PALETTE_SIZE_DFL        1024
+#define PALETTE_SIZE_MAX        65536
+
 namespace lsp
 {
     namespace tk
@@ -41,6 +44,7 @@ namespace lsp
                 sVScale.bind("vscale", this);
                 sColor.bind("color", this);
                 sFunction.bind("function", this);
+                sPaletteSize.bind("palette.size", this);
                 // Configure
                 sData.set_size(0, 0);
                 sData.set_range(0.0f, 1.0f, 0.0f);
@@ -52,6 +56,7 @@ namespace lsp
                 sVScale.set(1.0f);
                 sColor.set("#ff0000");
                 sFunction.set(GFF_DEFAULT);
+                sPaletteSize.set(PALETTE_SIZE_DFL);
             LSP_TK_STYLE_IMPL_END
             LSP_TK_BUILTIN_STYLE(GraphFrameBuffer, "GraphFrameBuffer", "root");
         }
@@ -68,7 +73,8 @@ namespace lsp
             sHScale(&sProperties),
             sVScale(&sProperties),
             sColor(&sProperties),
-            sFunction(&sProperties)
+            sFunction(&sProperties),
+            sPaletteSize(&sProperties)
         {
             bClear              = true;
             nRows               = 0;
@@ -80,6 +86,13 @@ namespace lsp
             nCapacity           = 0;
             nPixels             = 0;
 
+            vPalette            = NULL;
+            nPalette            = 0;
+            nPalRequest         = 0;
+            nPalCapacity        = 0;
+            fPalMin             = 0.0f;
+            fPalMax             = 0.0f;
+
             pClass              = &metadata;
         }
 
@@ -105,6 +118,14 @@ namespace lsp
             vRGBA               = NULL;
             pfRGBA              = NULL;
             nCapacity           = 0;
+
+            if (vPalette != NULL)
+                ::free(vPalette);
+
+            vPalette            = NULL;
+            nPalette            = 0;
+            nPalRequest         = 0;
+            nPalCapacity        = 0;
         }
 
         status_t GraphFrameBuffer::init()
@@ -123,6 +144,7 @@ namespace lsp
             sVScale.bind("vscale", &sStyle);
             sColor.bind("color", &sStyle);
             sFunction.bind("function", &sStyle);
+            sPaletteSize.bind("palette.size", &sStyle);
 
             return STATUS_OK;
         }
@@ -161,6 +183,15 @@ namespace lsp
             if (sColor.is(prop))
             {
                 bClear      = true;
+                nPalette    = 0;
+                nPalRequest = 0;
+                query_draw();
+            }
+            if (sPaletteSize.is(prop))
+            {
+                bClear      = true;
+                nPalette    = 0;
+                nPalRequest = 0;
                 query_draw();
             }
             if (sFunction.is(prop))
@@ -180,6 +211,8 @@ namespace lsp
                 {
                     pCalcColor  = func;
                     bClear      = true;
+                    nPalette    = 0;
+                    nPalRequest = 0;
                     query_draw();
                 }
             }
@@ -216,6 +249,22 @@ namespace lsp
                 nPixels         = pixels;
             }
 
+            // Re-build the palette if the size or the range of values has changed. The requested
+            // size is remembered even if the palette could not be built to not retry at each frame
+            float min           = lsp_min(sData.min(), sData.max());
+            float max           = lsp_max(sData.min(), sData.max());
+            size_t pal_size     = lsp_limit(sPaletteSize.get(), 0, PALETTE_SIZE_MAX);
+            if (pal_size < 2)
+                pal_size            = 0;
+            if ((nPalRequest != pal_size) ||
+                ((pal_size > 0) && ((fPalMin != min) || (fPalMax != max))))
+            {
+                nPalRequest     = pal_size;
+                if (!build_palette(pal_size, min, max))
+                    nPalette        = 0;
+                bClear          = true;
+            }
+
             // Need to deploy new changes?
             size_t changes = (bClear) ? nRows : sData.changes();
             if (changes <= 0)
@@ -234,8 +283,7 @@ namespace lsp
                 if (p == NULL)
                     continue;
 
-                (this->*pCalcColor)(fRGBA, p, nCols);
-                dsp::rgba_to_bgra32(xp, fRGBA, nCols);
+                convert_row(xp, p, nCols);
             }
 
             lsp::Color c(0.0f, 0.0f, 0.0f, 1.0f);
@@ -248,6 +296,72 @@ namespace lsp
             sData.advance();
         }
 
+        bool GraphFrameBuffer::build_palette(size_t size, float min, float max)
+        {
+            fPalMin         = min;
+            fPalMax         = max;
+            if (size < 2)
+            {
+                nPalette        = 0;
+                return true;
+            }
+
+            // Allocate the palette
+            if (nPalCapacity < size)
+            {
+                uint32_t *pal   = static_cast<uint32_t *>(::realloc(vPalette, size * sizeof(uint32_t)));
+                if (pal == NULL)
+                    return false;
+                vPalette        = pal;
+                nPalCapacity    = size;
+            }
+
+            // Allocate temporary buffers for values and colors
+            uint8_t *data   = NULL;
+            float *v        = lsp::alloc_aligned<float>(data, size * 5, DEFAULT_ALIGN);
+            if (v == NULL)
+                return false;
+            lsp_finally { lsp::free_aligned(data); };
+            float *rgba     = &v[size];
+
+            // Compute colors for the uniformly distributed values and convert them
+            float k         = (max - min) / (size - 1);
+            for (size_t i=0; i<size; ++i)
+                v[i]            = min + i * k;
+
+            (this->*pCalcColor)(rgba, v, size);
+            dsp::rgba_to_bgra32(vPalette, rgba, size);
+            nPalette        = size;
+
+            return true;
+        }
+
+        void GraphFrameBuffer::convert_row(uint8_t *dst, const float *v, size_t n)
+        {
+            // Compute each color if there is no palette
+            if (nPalette <= 0)
+            {
+                (this->*pCalcColor)(fRGBA, v, n);
+                dsp::rgba_to_bgra32(dst, fRGBA, n);
+                return;
+            }
+
+            // Quantize values and gather colors from the palette. Unlike the per-pixel
+            // computation, values outside of the data range are clamped to the colors of
+            // the range bounds. NaN values fail the comparison and take the first color.
+            const ssize_t last  = nPalette - 1;
+            const float range   = fPalMax - fPalMin;
+            const float k       = (range > 0.0f) ? last / range : 0.0f;
+            uint32_t *pix       = reinterpret_cast<uint32_t *>(dst);
+
+            for (size_t i=0; i<n; ++i)
+            {
+                const float x       = (v[i] - fPalMin) * k + 0.5f;
+                const ssize_t idx   = (x >= 0.0f) ? ((x < last) ? ssize_t(x) : last) : 0;
+                pix[i]              = vPalette[idx];
+            }
+        }
+
         void GraphFrameBuffer::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
         {
             // Check size
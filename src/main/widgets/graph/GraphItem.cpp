@@ -33,10 +33,12 @@ namespace lsp
                 sSmooth.bind("smooth", this);
                 sPriorityGroup.bind("proirity_group", this);
                 sPriority.bind("proirity", this);
+                sStaticLayer.bind("layer.static", this);
                 // Configure
                 sPriorityGroup.set(-1);
                 sPriority.set(0);
                 sSmooth.set(true);
+                sStaticLayer.set(false);
             LSP_TK_STYLE_IMPL_END
             LSP_TK_BUILTIN_STYLE(GraphItem, "GraphItem", "root");
         }
@@ -47,8 +49,13 @@ namespace lsp
             Widget(dpy),
             sSmooth(&sProperties),
             sPriorityGroup(&sProperties),
-            sPriority(&sProperties)
+            sPriority(&sProperties),
+            sStaticLayer(&sProperties)
         {
+            pListGraph      = NULL;
+            nDrawVersion    = 0;
+            nListVersion    = 0;
+            nListLayout     = 0;
         }
 
         GraphItem::~GraphItem()
@@ -66,6 +73,7 @@ namespace lsp
             sSmooth.bind("smooth", &sStyle);
             sPriorityGroup.bind("proirity_group", &sStyle);
             sPriority.bind("proirity", &sStyle);
+            sStaticLayer.bind("layer.static", &sStyle);
 
             return STATUS_OK;
         }
@@ -73,6 +81,8 @@ namespace lsp
         void GraphItem::destroy()
         {
             nFlags     |= FINALIZED;
+            sDrawList.destroy();
+            pListGraph  = NULL;
             Widget::destroy();
         }
 
@@ -80,8 +90,18 @@ namespace lsp
         {
             Widget::property_changed(prop);
 
+            // Any property may affect the output of the item
+            ++nDrawVersion;
+
             if (prop->one_of(sSmooth, sPriorityGroup, sPriority))
                 query_draw();
+            if (sStaticLayer.is(prop))
+            {
+                // The item leaves or enters the static layer
+                Graph *gr = graph();
+                if (gr != NULL)
+                    gr->query_static_draw();
+            }
         }
 
         Graph *GraphItem::graph()
@@ -96,6 +116,9 @@ namespace lsp
 
         void GraphItem::query_draw(size_t flags)
         {
+            if (flags & REDRAW_SURFACE)
+                ++nDrawVersion;
+
             Widget::query_draw(flags);
             if (!sVisibility.get())
                 return;
@@ -104,7 +127,15 @@ namespace lsp
             if (flags & (REDRAW_SURFACE | REDRAW_CHILD))
             {
                 Graph *gr = graph();
-                if (gr != NULL)
+                if (gr == NULL)
+                    return;
+
+                // Axes and origins affect the position of all other items
+                if ((sStaticLayer.get()) ||
+                    (widget_cast<GraphAxis>(this) != NULL) ||
+                    (widget_cast<GraphOrigin>(this) != NULL))
+                    gr->query_static_draw();
+                else
                     gr->query_draw(REDRAW_SURFACE);
             }
         }
@@ -114,6 +145,35 @@ namespace lsp
             return false;
         }
 
+        bool GraphItem::replay_draw_list(Graph *cv, ws::ISurface *s)
+        {
+            if ((pListGraph != cv) ||
+                (nListVersion != nDrawVersion) ||
+                (nListLayout != cv->layout_version()))
+                return false;
+
+            sDrawList.replay(s);
+            ++cv->sListStats.nReplayed;
+
+            return true;
+        }
+
+        DisplayList *GraphItem::begin_draw_list(Graph *cv)
+        {
+            sDrawList.clear();
+            pListGraph      = cv;
+            nListVersion    = nDrawVersion;
+            nListLayout     = cv->layout_version();
+
+            return &sDrawList;
+        }
+
+        void GraphItem::end_draw_list(Graph *cv, ws::ISurface *s)
+        {
+            sDrawList.replay(s);
+            ++cv->sListStats.nRecorded;
+        }
+
     } /* namespace tk */
 } /* namespace lsp */
 
@@ -259,6 +259,11 @@ namespace lsp
             Graph *cv           = graph();
             if (cv == NULL)
                 return;
+            if (replay_draw_list(cv, s))
+                return;
+
+            DisplayList *dl     = begin_draw_list(cv);
+            lsp_finally { end_draw_list(cv, s); };
 
             // Prepare palette
             float scaling       = lsp_max(0.0f, sScaling.get());
@@ -325,18 +330,17 @@ namespace lsp
                     {
                         dot2f_t p1      = shift2f(x[0], y[0], perp, -hw);
                         dot2f_t p2      = shift2f(x[0], y[0], perp, -(lborder + hw));
-                        ws::IGradient *g = s->linear_gradient(p1.x, p1.y, p2.x, p2.y);
-                        if (g != NULL)
+                        ssize_t g       = dl->linear_gradient(p1.x, p1.y, p2.x, p2.y);
+                        if (g >= 0)
                         {
-                            lsp_finally { delete g; };
-                            g->add_color(0.0f, bcol_l);
-                            g->add_color(1.0f, bcol_l, 1.0f);
+                            dl->add_color(g, 0.0f, bcol_l);
+                            dl->add_color(g, 1.0f, bcol_l, 1.0f);
 
                             dot2f_t p3      = shift2f(x[1], y[1], perp, -(lborder + hw));
                             dot2f_t p4      = shift2f(x[1], y[1], perp, -hw);
                             float px[5]     = { p1.x, p2.x, p3.x, p4.x, p1.x };
                             float py[5]     = { p1.y, p2.y, p3.y, p4.y, p1.y };
-                            s->fill_poly(g, px, py, 5);
+                            dl->fill_poly(g, px, py, 5);
                         }
                     }
 
@@ -344,27 +348,25 @@ namespace lsp
                     {
                         dot2f_t p1      = shift2f(x[0], y[0], perp, hw);
                         dot2f_t p2      = shift2f(x[0], y[0], perp, (rborder + hw));
-                        ws::IGradient *g = s->linear_gradient(p1.x, p1.y, p2.x, p2.y);
-                        if (g != NULL)
+                        ssize_t g       = dl->linear_gradient(p1.x, p1.y, p2.x, p2.y);
+                        if (g >= 0)
                         {
-                            lsp_finally { delete g; };
-                            g->add_color(0.0f, bcol_r);
-                            g->add_color(1.0f, bcol_r, 1.0f);
+                            dl->add_color(g, 0.0f, bcol_r);
+                            dl->add_color(g, 1.0f, bcol_r, 1.0f);
 
                             dot2f_t p3      = shift2f(x[1], y[1], perp, (rborder + hw));
                             dot2f_t p4      = shift2f(x[1], y[1], perp, hw);
                             float px[5]     = { p1.x, p2.x, p3.x, p4.x, p1.x };
                             float py[5]     = { p1.y, p2.y, p3.y, p4.y, p1.y };
-                            s->fill_poly(g, px, py, 5);
+                            dl->fill_poly(g, px, py, 5);
                         }
                     }
                 }
             }
 
             // Draw line
-            bool aa     = s->set_antialiasing(sSmooth.get());
-            lsp_finally { s->set_antialiasing(aa); };
-            s->line(
+            dl->set_antialiasing(sSmooth.get());
+            dl->line(
                 color,
                 x[0], y[0], x[1], y[1],
                 l_width);
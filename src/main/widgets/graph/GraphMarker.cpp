@@ -214,6 +214,11 @@ namespace lsp
             Graph *cv           = graph();
             if (cv == NULL)
                 return;
+            if (replay_draw_list(cv, s))
+                return;
+
+            DisplayList *dl     = begin_draw_list(cv);
+            lsp_finally { end_draw_list(cv, s); };
 
             // Prepare palette
             float scaling       = lsp_max(0.0f, sScaling.get());
@@ -305,51 +310,45 @@ namespace lsp
             }
 
             // Draw line
-            bool aa     = s->set_antialiasing(sSmooth.get());
+            dl->set_antialiasing(sSmooth.get());
 
             prop::Integer *w = (nXFlags & F_HIGHLIGHT) ? &sHWidth : &sWidth;
             ssize_t l_width  = (w->get() > 0) ? lsp_max(1.0f, w->get() * scaling) : 0;
 
             if (lborder > 0)
             {
-                ws::IGradient *g = s->linear_gradient(x, y, nl[0], nl[1]);
-                if (g != NULL)
+                ssize_t g = dl->linear_gradient(x, y, nl[0], nl[1]);
+                if (g >= 0)
                 {
-                    g->add_color(0.0f, bcol_l);
-                    g->add_color(1.0f, bcol_l, 1.0f);
+                    dl->add_color(g, 0.0f, bcol_l);
+                    dl->add_color(g, 1.0f, bcol_l, 1.0f);
 
-                    s->parametric_bar(
+                    dl->parametric_bar(
                         g,
                         ll[0], ll[1], ll[2], bl[0], bl[1], bl[2],
                         cv->canvas_left(), cv->canvas_right(), cv->canvas_bottom(), cv->canvas_top());
-
-                    delete g;
                 }
             }
             if (rborder > 0)
             {
-                ws::IGradient *g = s->linear_gradient(x, y, nr[0], nr[1]);
-                if (g != NULL)
+                ssize_t g = dl->linear_gradient(x, y, nr[0], nr[1]);
+                if (g >= 0)
                 {
-                    g->add_color(0.0f, bcol_r);
-                    g->add_color(1.0f, bcol_r, 1.0f);
+                    dl->add_color(g, 0.0f, bcol_r);
+                    dl->add_color(g, 1.0f, bcol_r, 1.0f);
 
-                    s->parametric_bar(
+                    dl->parametric_bar(
                         g,
                         ll[0], ll[1], ll[2], br[0], br[1], br[2],
                         cv->canvas_left(), cv->canvas_right(), cv->canvas_bottom(), cv->canvas_top());
-
-                    delete g;
                 }
             }
 
-            s->parametric_line(
+            dl->parametric_line(
                 color,
                 ll[0], ll[1], ll[2],
                 cv->canvas_left(), cv->canvas_right(), cv->canvas_bottom(), cv->canvas_top(),
                 l_width);
-
-            s->set_antialiasing(aa);
         }
 
         bool GraphMarker::inside(ssize_t mx, ssize_t my)
@@ -72,6 +72,7 @@ namespace lsp
         {
             vBuffer             = NULL;
             nCapacity           = 0;
+            sGeometry.bValid    = false;
 
             pClass              = &metadata;
         }
@@ -97,6 +98,7 @@ namespace lsp
                 vBuffer         = NULL;
             }
             nCapacity       = 0;
+            sGeometry.bValid= false;
         }
 
         status_t GraphMesh::init()
@@ -176,6 +178,64 @@ namespace lsp
             return off - start;
         }
 
+        bool GraphMesh::project(GraphAxis *xaxis, GraphAxis *yaxis, float cx, float cy, size_t off)
+        {
+            // Versions of axis transforms also track the changes of the canvas size
+            size_t xv           = xaxis->transform_version();
+            size_t yv           = yaxis->transform_version();
+            if ((xv == 0) || (yv == 0))
+                return false;
+
+            const GraphMeshData *data   = &sData;
+            size_t vec_size     = data->size();
+            geometry_t *g       = &sGeometry;
+            if ((g->bValid) &&
+                (g->nVersion == data->version()) && (g->nSize == vec_size) && (g->nOffset == off) &&
+                (g->pXAxis == xaxis) && (g->pYAxis == yaxis) &&
+                (g->nXVersion == xv) && (g->nYVersion == yv) &&
+                (g->fCX == cx) && (g->fCY == cy))
+                return true;
+
+            g->bValid           = false;
+
+            // Ensure that we have enough buffer size
+            size_t cap_size     = align_size(vec_size * 2, DEFAULT_ALIGN);
+            if (nCapacity < cap_size)
+            {
+                float *buf          = static_cast<float *>(realloc(vBuffer, cap_size * sizeof(float)));
+                if (buf == NULL)
+                    return false;
+                vBuffer             = buf;
+                nCapacity           = cap_size;
+            }
+
+            // Initialize dimensions as zeros and calculate coordinates for each dot
+            size_t length       = vec_size - off;
+            float *x_vec        = &vBuffer[off];
+            float *y_vec        = &vBuffer[vec_size + off];
+            dsp::fill(x_vec, cx, length);
+            dsp::fill(y_vec, cy, length);
+
+            if (!xaxis->apply(x_vec, y_vec, &data->x()[off], length))
+                return false;
+            if (!yaxis->apply(x_vec, y_vec, &data->y()[off], length))
+                return false;
+
+            // Remember the key of computed geometry
+            g->bValid           = true;
+            g->nVersion         = data->version();
+            g->nSize            = vec_size;
+            g->nOffset          = off;
+            g->pXAxis           = xaxis;
+            g->pYAxis           = yaxis;
+            g->nXVersion        = xv;
+            g->nYVersion        = yv;
+            g->fCX              = cx;
+            g->fCY              = cy;
+
+            return true;
+        }
+
         void GraphMesh::render(ws::ISurface *s, const ws::rectangle_t *area, bool force)
         {
             // Get graph
@@ -204,35 +264,26 @@ namespace lsp
             float cx = 0.0f, cy = 0.0f;
             cv->origin(sOrigin.get(), &cx, &cy);
 
-            // Ensure that we have enough buffer size
-            size_t cap_size     = align_size(sData.size() * 2, DEFAULT_ALIGN);
-            if (nCapacity < cap_size)
-            {
-                float *buf          = static_cast<float *>(realloc(vBuffer, cap_size * sizeof(float)));
-                if (buf == NULL)
-                    return;
-                vBuffer             = buf;
-                nCapacity           = cap_size;
-            }
+            // Find the first point of the mesh to draw, use read-only access to keep external buffers attached
+            const GraphMeshData *data   = &sData;
+            size_t vec_size     = data->size();
+            const float *s_src  = data->s();
+            size_t strobes      = lsp_max(sStrobes.get(), 0);
+            size_t found        = 0;
+            size_t off          = (sData.strobe()) ? find_offset(&found, s_src, vec_size, strobes) : 0;
 
-            // Initialize X and Y vectors
-            size_t vec_size     = sData.size();
-            float *x_vec        = &vBuffer[0];
-            float *y_vec        = &x_vec[vec_size];
-            const float *x_src  = sData.x();
-            const float *y_src  = sData.y();
+            // Project points or re-use the geometry computed at previous frames
+            if (!project(xaxis, yaxis, cx, cy, off))
+                return;
 
             // Now we have dots in x_vec[] and y_vec[]
+            const float *x_vec  = &vBuffer[0];
+            const float *y_vec  = &vBuffer[vec_size];
             bool aa = s->set_antialiasing(sSmooth.get());
 
             if (sData.strobe())
             {
-                const float *s_src  = sData.s();
-
                 // Draw mesh divided into segments using strobes
-                size_t strobes      = lsp_max(sStrobes.get(), 0);
-                size_t found        = 0;
-                size_t off          = (sData.strobe()) ? find_offset(&found, s_src, vec_size, strobes) : 0;
                 ssize_t op          = strobes - found + 1;      // Initial opacity coefficient
                 float kop           = 1.0f / (strobes + 1.0f);  // Opacity coefficient
 
@@ -242,16 +293,6 @@ namespace lsp
                     size_t length       = get_length(s_src, off, vec_size);
                     float ka            = (op++) * kop;
 
-                    // Initialize dimensions as zeros
-                    dsp::fill(x_vec, cx, vec_size);
-                    dsp::fill(y_vec, cy, vec_size);
-
-                    // Calculate coordinates for each dot
-                    if (!xaxis->apply(x_vec, y_vec, &x_src[off], length))
-                        return;
-                    if (!yaxis->apply(x_vec, y_vec, &y_src[off], length))
-                        return;
-
                     // Draw part of mesh
                     line.copy(sColor);
                     line.alpha(1.0f - (1.0f - line.alpha()) * ka);
@@ -260,10 +301,10 @@ namespace lsp
                     {
                         fill.copy(sFillColor);
                         fill.alpha(1.0f - (1.0f - line.alpha()) * ka);
-                        s->draw_poly(fill, line, width, x_vec, y_vec, length);
+                        s->draw_poly(fill, line, width, &x_vec[off], &y_vec[off], length);
                     }
                     else if (width > 0)
-                        s->wire_poly(line, width, x_vec, y_vec, length);
+                        s->wire_poly(line, width, &x_vec[off], &y_vec[off], length);
 
                     // Update offset
                     off                += length;
@@ -271,16 +312,6 @@ namespace lsp
             }
             else
             {
-                // Initialize dimensions as zeros
-                dsp::fill(x_vec, cx, vec_size);
-                dsp::fill(y_vec, cy, vec_size);
-
-                // Calculate coordinates for each dot
-                if (!xaxis->apply(x_vec, y_vec, x_src, vec_size))
-                    return;
-                if (!yaxis->apply(x_vec, y_vec, y_src, vec_size))
-                    return;
-
                 if (sFill.get())
                     s->draw_poly(fill, line, width, x_vec, y_vec, vec_size);
                 else if (width > 0)
@@ -39,6 +39,10 @@ namespace lsp
                 sTop.set_all(0.0f, -1.0f, 1.0f);
                 sRadius.set(4.0f);
                 sColor.set("#ffffff");
+                // Override
+                sStaticLayer.set(true);
+                // Commit
+                sStaticLayer.override();
             LSP_TK_STYLE_IMPL_END
             LSP_TK_BUILTIN_STYLE(GraphOrigin, "GraphOrigin", "root");
         }
@@ -104,6 +108,11 @@ namespace lsp
             Graph *cv = graph();
             if (cv == NULL)
                 return;
+            if (replay_draw_list(cv, s))
+                return;
+
+            DisplayList *dl = begin_draw_list(cv);
+            lsp_finally { end_draw_list(cv, s); };
 
             // Generate palette
             float scaling   = lsp_max(0.0f, sScaling.get());
@@ -114,9 +123,8 @@ namespace lsp
             // Draw circle
             float x=0.0f, y=0.0f;
             cv->origin(this, &x, &y);
-            bool aa = s->set_antialiasing(sSmooth.get());
-            s->fill_circle(color, x, y, radius);
-            s->set_antialiasing(aa);
+            dl->set_antialiasing(sSmooth.get());
+            dl->fill_circle(color, x, y, radius);
         }
     }
 }
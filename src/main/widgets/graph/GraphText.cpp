@@ -52,9 +52,11 @@ namespace lsp
                 sOrigin.set(0);
                 // Override
                 sPadding.set(2);
+                sStaticLayer.set(true);
                 // Commit
                 sFont.override();
                 sPadding.override();
+                sStaticLayer.override();
             LSP_TK_STYLE_IMPL_END
             LSP_TK_BUILTIN_STYLE(GraphText, "GraphText", "root");
         }
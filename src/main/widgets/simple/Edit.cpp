@@ -416,6 +416,7 @@ namespace lsp
             if (_this == NULL)
                 return STATUS_BAD_ARGUMENTS;
             _this->update_scroll();
+            _this->request_animation();
             return STATUS_OK;
         }
 
@@ -145,11 +145,48 @@ namespace lsp
 
             nDWidth     = -1;
             nDHeight    = -1;
+
+            sAtlasKey.nWidth    = -1;
+            sAtlasKey.nHeight   = -1;
+            sAtlasKey.nColor    = 0;
+            sAtlasKey.nOn       = 0;
+            sAtlasKey.nOff      = 0;
+            sAtlasKey.fScaling  = 0.0f;
+            sAtlasKey.bDark     = false;
         }
         
         Indicator::~Indicator()
         {
             nFlags     |= FINALIZED;
+            do_destroy();
+        }
+
+        void Indicator::destroy()
+        {
+            nFlags     |= FINALIZED;
+            Widget::destroy();
+            do_destroy();
+        }
+
+        void Indicator::do_destroy()
+        {
+            drop_glyphs();
+            vGlyphs.flush();
+        }
+
+        void Indicator::drop_glyphs()
+        {
+            for (size_t i=0, n=vGlyphs.size(); i<n; ++i)
+            {
+                glyph_t *g      = vGlyphs.uget(i);
+                if (g->pSurface != NULL)
+                {
+                    g->pSurface->destroy();
+                    delete g->pSurface;
+                    g->pSurface     = NULL;
+                }
+            }
+            vGlyphs.clear();
         }
 
         status_t Indicator::init()
@@ -248,6 +285,79 @@ namespace lsp
             }
         }
 
+        void Indicator::validate_glyphs(const lsp::Color &color, const lsp::Color &on, const lsp::Color &off)
+        {
+            atlas_key_t key;
+            key.nWidth      = nDWidth;
+            key.nHeight     = nDHeight;
+            key.nColor      = color.rgba32();
+            key.nOn         = on.rgba32();
+            key.nOff        = off.rgba32();
+            key.fScaling    = lsp_max(0.0f, sScaling.get() * sFontScaling.get());
+            key.bDark       = sDarkText.get();
+
+            if ((key.nWidth == sAtlasKey.nWidth) &&
+                (key.nHeight == sAtlasKey.nHeight) &&
+                (key.nColor == sAtlasKey.nColor) &&
+                (key.nOn == sAtlasKey.nOn) &&
+                (key.nOff == sAtlasKey.nOff) &&
+                (key.fScaling == sAtlasKey.fScaling) &&
+                (key.bDark == sAtlasKey.bDark))
+                return;
+
+            drop_glyphs();
+            sAtlasKey       = key;
+        }
+
+        ws::ISurface *Indicator::get_glyph(ws::ISurface *s, size_t state, const lsp::Color &color, const lsp::Color &on, const lsp::Color &off)
+        {
+            // Lookup for already rendered glyph, the number of distinct states is small
+            for (size_t i=0, n=vGlyphs.size(); i<n; ++i)
+            {
+                glyph_t *g      = vGlyphs.uget(i);
+                if (g->nState == state)
+                    return g->pSurface;
+            }
+
+            if ((nDWidth <= 0) || (nDHeight <= 0))
+                return NULL;
+
+            // Render the glyph over the glass
+            ws::ISurface *gs    = s->create(nDWidth, nDHeight);
+            if (gs == NULL)
+                return NULL;
+
+            glyph_t *g          = vGlyphs.add();
+            if (g == NULL)
+            {
+                gs->destroy();
+                delete gs;
+                return NULL;
+            }
+            g->nState           = state;
+            g->pSurface         = gs;
+
+            gs->begin();
+            {
+                gs->clear(color);
+                bool aa = gs->set_antialiasing(true);
+                draw_digit(gs, 0.0f, 0.0f, state, on, off);
+                gs->set_antialiasing(aa);
+            }
+            gs->end();
+
+            return gs;
+        }
+
+        void Indicator::draw_glyph(ws::ISurface *s, float x, float y, size_t state, const lsp::Color &color, const lsp::Color &on, const lsp::Color &off)
+        {
+            ws::ISurface *gs    = get_glyph(s, state, color, on, off);
+            if (gs != NULL)
+                s->draw(gs, x, y, 1.0f, 1.0f, 0.0f);
+            else
+                draw_digit(s, x, y, state, on, off);
+        }
+
         void Indicator::draw_simple(ws::ISurface *s, float x, float y, char ch, const lsp::Color &on, const ws::font_parameters_t *fp)
         {
             float fscaling  = lsp_max(0.0f, sScaling.get() * sFontScaling.get());
@@ -409,6 +519,8 @@ namespace lsp
             }
             else
             {
+                validate_glyphs(color, on, off);
+
                 uint8_t unget = 0;
                 for (size_t offset = 0, ich = 0; offset < last; )
                 {
@@ -468,22 +580,22 @@ namespace lsp
                     if (ch == '\n') // Need to fill up to end-of-line
                     {
                         for ( ; col < cols; ++col, ++offset)
-                            draw_digit
+                            draw_glyph
                             (
                                 s,
                                 xr.nLeft + col*(nDWidth + spacing),
                                 xr.nTop  + row*(nDHeight + spacing),
-                                state, on, off
+                                state, color, on, off
                             );
                     }
                     else
                     {
-                        draw_digit
+                        draw_glyph
                         (
                             s,
                             xr.nLeft + col*(nDWidth + spacing),
                             xr.nTop  + row*(nDHeight + spacing),
-                            state, on, off
+                            state, color, on, off
                         );
                         ++offset;
                     }
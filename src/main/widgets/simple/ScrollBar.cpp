@@ -402,6 +402,7 @@ namespace lsp
             if (_this == NULL)
                 return STATUS_BAD_ARGUMENTS;
             _this->update_by_timer();
+            _this->request_animation();
             return STATUS_OK;
         }
 
@@ -419,6 +419,7 @@ MTEST_BEGIN("tk.widgets.graph", graph)
                     gm->origin()->set(0);
                     gm->basis()->set(0);
                     gm->parallel()->set(1);
+                    gm->static_layer()->set(true);
 
                     const marker_t *m = &vmarkers[i];
                     gm->color()->set_rgb24(m->color);
@@ -453,6 +454,7 @@ MTEST_BEGIN("tk.widgets.graph", graph)
                     gm->origin()->set(0);
                     gm->basis()->set(1);
                     gm->parallel()->set(0);
+                    gm->static_layer()->set(true);
 
                     const marker_t *m = &hmarkers[i];
                     gm->color()->set_rgb24(m->color);
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/io/Path.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+#define NUM_CHANNELS        64
+
+PTEST_BEGIN("tk.style", prototype, 5, 100)
+
+    bool create_strips(tk::Display *dpy, lltl::parray<tk::Widget> &widgets,
+        tk::Fader *fader, tk::Knob *knob, tk::Label *label)
+    {
+        for (size_t i=0; i<NUM_CHANNELS; ++i)
+        {
+            if (test::create<tk::Fader>(dpy, &widgets, NULL, fader) == NULL)
+                return false;
+            if (test::create<tk::Knob>(dpy, &widgets, NULL, knob) == NULL)
+                return false;
+            if (test::create<tk::Label>(dpy, &widgets, NULL, label) == NULL)
+                return false;
+        }
+        return true;
+    }
+
+    PTEST_MAIN
+    {
+        io::Path path;
+        tk::StyleSheet sheet;
+        lltl::parray<tk::Widget> protos, widgets;
+
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        PTEST_ASSERT(path.fmt("%s/schema/lsp.xml", resources()) > 0);
+        PTEST_ASSERT(sheet.parse_file(&path) == STATUS_OK);
+        PTEST_ASSERT(dpy->schema()->apply(&sheet) == STATUS_OK);
+
+        // Create prototypes of the channel strip
+        tk::Fader *fader = test::create<tk::Fader>(dpy, &protos);
+        PTEST_ASSERT(fader != NULL);
+        fader->scale_color()->set("#00ccff");
+        tk::Knob *knob = test::create<tk::Knob>(dpy, &protos);
+        PTEST_ASSERT(knob != NULL);
+        knob->scale_color()->set("#00ccff");
+        tk::Label *label = test::create<tk::Label>(dpy, &protos);
+        PTEST_ASSERT(label != NULL);
+        label->text()->set_raw("Channel");
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "init x %d strips", int(NUM_CHANNELS));
+        printf("Testing initialization of %d channel strips...\n", int(NUM_CHANNELS));
+        PTEST_LOOP(buf,
+            create_strips(dpy, widgets, NULL, NULL, NULL);
+            test::destroy_all(NULL, &widgets);
+        );
+
+        snprintf(buf, sizeof(buf), "prototype x %d strips", int(NUM_CHANNELS));
+        printf("Testing initialization of %d channel strips from prototypes...\n", int(NUM_CHANNELS));
+        PTEST_LOOP(buf,
+            create_strips(dpy, widgets, fader, knob, label);
+            test::destroy_all(NULL, &widgets);
+        );
+
+        test::destroy_all(dpy, &protos);
+    }
+
+PTEST_END
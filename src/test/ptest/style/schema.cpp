@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/io/Path.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+#define NUM_WIDGETS         256
+
+PTEST_BEGIN("tk.style", schema, 5, 100)
+
+    PTEST_MAIN
+    {
+        io::Path path;
+        tk::StyleSheet sheet, sheet2;
+        lltl::parray<tk::Widget> widgets;
+
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        PTEST_ASSERT(path.fmt("%s/schema/lsp.xml", resources()) > 0);
+        PTEST_ASSERT(sheet.parse_file(&path) == STATUS_OK);
+        PTEST_ASSERT(path.fmt("%s/schema/lsp_v2.xml", resources()) > 0);
+        PTEST_ASSERT(sheet2.parse_file(&path) == STATUS_OK);
+
+        printf("Testing schema apply to empty display...\n");
+        PTEST_LOOP("apply",
+            dpy->schema()->apply(&sheet);
+        );
+
+        // Create widgets bound to the schema
+        for (size_t i=0; i<NUM_WIDGETS; ++i)
+        {
+            tk::Widget *w = ((i % 3) == 0) ? static_cast<tk::Widget *>(new tk::Button(dpy)) :
+                            ((i % 3) == 1) ? static_cast<tk::Widget *>(new tk::Label(dpy)) :
+                            static_cast<tk::Widget *>(new tk::Knob(dpy));
+            PTEST_ASSERT(w != NULL);
+            PTEST_ASSERT(widgets.add(w));
+            PTEST_ASSERT(w->init() == STATUS_OK);
+        }
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "apply x %d widgets", int(NUM_WIDGETS));
+        printf("Testing schema apply with %d widgets...\n", int(NUM_WIDGETS));
+        PTEST_LOOP(buf,
+            dpy->schema()->apply(&sheet);
+        );
+
+        // Switch between two themes, only the difference is applied
+        size_t counter = 0;
+        snprintf(buf, sizeof(buf), "swap x %d widgets", int(NUM_WIDGETS));
+        printf("Testing theme swap with %d widgets...\n", int(NUM_WIDGETS));
+        PTEST_LOOP(buf,
+            dpy->schema()->apply((counter++ & 1) ? &sheet : &sheet2);
+        );
+
+        test::destroy_all(dpy, &widgets);
+    }
+
+PTEST_END
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/runtime/LSPString.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+#define LAYERS              40
+#define LAYER_WIDTH         50
+
+PTEST_BEGIN("tk.style", stylesheet, 5, 100)
+
+    // Each style inherits two styles of the previous layer, so the hierarchy
+    // is deep and consists of overlapping diamonds
+    bool make_sheet(LSPString *text)
+    {
+        if (!text->set_ascii("<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n<schema>\n\t<root />\n"))
+            return false;
+
+        for (size_t i=0; i<LAYERS; ++i)
+            for (size_t j=0; j<LAYER_WIDTH; ++j)
+            {
+                ssize_t res = (i == 0) ?
+                    text->fmt_append_ascii("\t<style class=\"s%d_%d\" parents=\"root\">\n", int(i), int(j)) :
+                    text->fmt_append_ascii("\t<style class=\"s%d_%d\" parents=\"s%d_%d,s%d_%d\">\n",
+                        int(i), int(j), int(i-1), int(j), int(i-1), int((j + 1) % LAYER_WIDTH));
+                if (res <= 0)
+                    return false;
+                res = text->fmt_append_ascii("\t\t<value value=\"%d\" />\n\t</style>\n", int(i * LAYER_WIDTH + j));
+                if (res <= 0)
+                    return false;
+            }
+
+        return text->append_ascii("</schema>\n");
+    }
+
+    PTEST_MAIN
+    {
+        LSPString text;
+        PTEST_ASSERT(make_sheet(&text));
+
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "parse %d styles", int(LAYERS * LAYER_WIDTH));
+        printf("Testing parse and validation of %d styles...\n", int(LAYERS * LAYER_WIDTH));
+        PTEST_LOOP(buf,
+            tk::StyleSheet sheet;
+            sheet.parse_data(&text);
+        );
+
+        tk::StyleSheet sheet;
+        PTEST_ASSERT(sheet.parse_data(&text) == STATUS_OK);
+
+        snprintf(buf, sizeof(buf), "apply %d styles", int(LAYERS * LAYER_WIDTH));
+        printf("Testing schema apply of %d styles...\n", int(LAYERS * LAYER_WIDTH));
+        PTEST_LOOP(buf,
+            dpy->schema()->apply(&sheet);
+        );
+
+        test::destroy_all(dpy, NULL);
+    }
+
+PTEST_END
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+#define WINDOWS             20
+#define WINDOW_WIDTH        320
+#define WINDOW_HEIGHT       200
+
+PTEST_BEGIN("tk.sys", frame_scheduler, 5, 1000)
+
+    void redraw_all(tk::Display *dpy, lltl::parray<tk::Widget> *labels)
+    {
+        for (size_t i=0, n=labels->size(); i<n; ++i)
+            labels->uget(i)->query_draw();
+        dpy->main_iteration();
+    }
+
+    PTEST_MAIN
+    {
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        lltl::parray<tk::Widget> widgets, labels;
+
+        for (size_t i=0; i<WINDOWS; ++i)
+        {
+            tk::Window *wnd = new tk::Window(dpy);
+            PTEST_ASSERT(widgets.add(wnd));
+            tk::Label *label = new tk::Label(dpy);
+            PTEST_ASSERT(widgets.add(label));
+            PTEST_ASSERT(labels.add(label));
+
+            wnd->init();
+            wnd->size()->set(WINDOW_WIDTH, WINDOW_HEIGHT);
+            label->init();
+            label->text()->set_raw("Editor");
+            wnd->add(label);
+            wnd->visibility()->set(true);
+        }
+
+        // Map windows and render the first frame
+        for (size_t i=0; i<10; ++i)
+            dpy->main_iteration();
+
+        tk::FrameScheduler *fs = dpy->frame_scheduler();
+        fs->reset_stats();
+
+        printf("Testing idle main loop with %d windows...\n", WINDOWS);
+        PTEST_LOOP("idle",
+            dpy->main_iteration();
+        );
+
+        printf("Testing redraw of %d windows...\n", WINDOWS);
+        PTEST_LOOP("redraw",
+            redraw_all(dpy, &labels);
+        );
+
+        tk::frame_stats_t stats;
+        fs->get_stats(&stats);
+        printf("Frame scheduler: target fps=%.1f, achieved fps=%.1f, render time=%.2f ms, "
+               "requests=%d, frames=%d, skipped=%d, idle=%d\n",
+            stats.fTargetFPS, stats.fAchievedFPS, stats.fRenderTime,
+            int(stats.nRequests), int(stats.nFrames), int(stats.nSkipped), int(stats.nIdle));
+
+        // Widgets are destroyed in reverse order: labels before their windows
+        labels.flush();
+        test::destroy_all(dpy, &widgets);
+    }
+
+PTEST_END
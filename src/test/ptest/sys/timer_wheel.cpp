@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+#define TIMERS              500
+
+PTEST_BEGIN("tk.sys", timer_wheel, 5, 1000)
+
+    static status_t on_timer(ws::timestamp_t sched, ws::timestamp_t time, void *arg)
+    {
+        size_t *counter = static_cast<size_t *>(arg);
+        ++(*counter);
+        return STATUS_OK;
+    }
+
+    void relaunch_all(tk::Timer *timers)
+    {
+        for (size_t i=0; i<TIMERS; ++i)
+            timers[i].launch(0, 100 + (i % 10) * 50, i % 100);
+    }
+
+    void cancel_all(tk::Timer *timers)
+    {
+        for (size_t i=0; i<TIMERS; ++i)
+            timers[i].cancel();
+    }
+
+    PTEST_MAIN
+    {
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        size_t counter = 0;
+        tk::Timer *timers = new tk::Timer[TIMERS];
+        PTEST_ASSERT(timers != NULL);
+        for (size_t i=0; i<TIMERS; ++i)
+        {
+            timers[i].bind(dpy);
+            timers[i].set_handler(on_timer, &counter);
+        }
+
+        printf("Testing launch and cancel of %d timers...\n", TIMERS);
+        PTEST_LOOP("launch",
+            relaunch_all(timers);
+            cancel_all(timers);
+        );
+
+        // Blinking cursors and auto-repeat timers of a large editor
+        relaunch_all(timers);
+        tk::TimerWheel *wheel = dpy->timer_wheel();
+        wheel->reset_stats();
+
+        printf("Testing main loop with %d active timers...\n", TIMERS);
+        PTEST_LOOP("run",
+            dpy->main_iteration();
+        );
+
+        tk::timer_wheel_stats_t stats;
+        wheel->get_stats(&stats);
+        printf("Timer wheel: active=%d, wakeups=%d, expired=%d, wakeup rate=%.1f/s, handler calls=%d\n",
+            int(stats.nActive), int(stats.nWakeups), int(stats.nExpired), stats.fWakeupRate, int(counter));
+
+        cancel_all(timers);
+        delete [] timers;
+        test::destroy_all(dpy, NULL);
+    }
+
+PTEST_END
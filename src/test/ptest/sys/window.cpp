@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+#define WINDOW_WIDTH        640
+#define WINDOW_HEIGHT       400
+
+PTEST_BEGIN("tk.sys", window, 5, 1000)
+
+    void construct(tk::Display *dpy, bool show)
+    {
+        tk::Window *wnd = new tk::Window(dpy);
+        tk::Label *label = new tk::Label(dpy);
+
+        wnd->init();
+        wnd->title()->set_raw("Test window");
+        wnd->size()->set(WINDOW_WIDTH, WINDOW_HEIGHT);
+
+        label->init();
+        label->text()->set_raw("Test label");
+        wnd->add(label);
+
+        if (show)
+        {
+            wnd->visibility()->set(true);
+            dpy->main_iteration();
+        }
+
+        label->destroy();
+        delete label;
+        wnd->destroy();
+        delete wnd;
+    }
+
+    PTEST_MAIN
+    {
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        printf("Testing window construction...\n");
+        PTEST_LOOP("construct",
+            construct(dpy, false);
+        );
+
+        printf("Testing window construction and mapping...\n");
+        PTEST_LOOP("construct+show",
+            construct(dpy, true);
+        );
+
+        test::destroy_all(dpy, NULL);
+    }
+
+PTEST_END
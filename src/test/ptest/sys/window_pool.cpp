@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+PTEST_BEGIN("tk.sys", window_pool, 5, 1000)
+
+    void popup(tk::Display *dpy, tk::PopupWindow *wnd)
+    {
+        wnd->show();
+        dpy->main_iteration();
+        wnd->hide();
+        dpy->main_iteration();
+    }
+
+    PTEST_MAIN
+    {
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        lltl::parray<tk::Widget> widgets;
+
+        tk::PopupWindow *wnd = new tk::PopupWindow(dpy);
+        PTEST_ASSERT(widgets.add(wnd));
+        tk::Label *label = new tk::Label(dpy);
+        PTEST_ASSERT(widgets.add(label));
+
+        PTEST_ASSERT(wnd->init() == STATUS_OK);
+        PTEST_ASSERT(label->init() == STATUS_OK);
+        label->text()->set_raw("Menu item");
+        PTEST_ASSERT(wnd->add(label) == STATUS_OK);
+
+        tk::WindowPool *pool = dpy->window_pool();
+
+        printf("Testing popup show/hide with pooled native windows...\n");
+        PTEST_LOOP("pooled",
+            popup(dpy, wnd);
+        );
+
+        tk::window_pool_stats_t stats;
+        pool->get_stats(&stats);
+        printf("Window pool: capacity=%d, free=%d, created=%d, reused=%d, resized=%d, destroyed=%d\n",
+            int(stats.nCapacity), int(stats.nFree), int(stats.nCreated),
+            int(stats.nReused), int(stats.nResized), int(stats.nDestroyed));
+
+        pool->set_capacity(0);
+        printf("Testing popup show/hide without pooling...\n");
+        PTEST_LOOP("unpooled",
+            popup(dpy, wnd);
+        );
+
+        test::destroy_all(dpy, &widgets);
+    }
+
+PTEST_END
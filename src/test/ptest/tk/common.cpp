@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <private/ptest/tk/common.h>
+#include <private/tk/sys/HeadlessSurface.h>
+
+namespace lsp
+{
+    namespace test
+    {
+        /**
+         * Ensure that virtual calls of the window system interfaces are dispatched to
+         * the headless backend. If any signature of ws::IDisplay or ws::ISurface does
+         * not match the backend, the default no-op implementation gets called instead
+         * and the performance tests measure nothing.
+         */
+        static bool check_headless_backend(tk::Display *dpy)
+        {
+            ws::IDisplay *xdpy  = dpy->display();
+            if (xdpy == NULL)
+                return false;
+
+            ws::Font f;
+            ws::text_parameters_t tp;
+            f.set_size(10.0f);
+            tp.Width            = 0.0f;
+            if ((!xdpy->get_text_parameters(f, &tp, "test")) || (tp.Width <= 0.0f))
+                return false;
+
+            ws::ISurface *s     = xdpy->create_surface(2, 2);
+            if (s == NULL)
+                return false;
+
+            s->begin();
+                s->clear_rgba(0x12345678);
+                s->fill_rect(lsp::Color(0.0f, 0.0f, 0.0f, 0.0f), SURFMASK_NONE, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f);
+            s->end();
+
+            const uint32_t *data = static_cast<tk::HeadlessSurface *>(s)->data();
+            bool ok             = (s->type() == ws::ST_IMAGE) &&
+                                  (data != NULL) &&
+                                  (data[0] == 0x12345678) &&
+                                  (data[3] != 0x12345678);
+
+            s->destroy();
+            delete s;
+
+            return ok;
+        }
+
+        tk::Display *create_headless_display()
+        {
+            tk::display_settings_t settings;
+            settings.headless   = true;
+
+            tk::Display *dpy    = new tk::Display(&settings);
+            if (dpy == NULL)
+                return NULL;
+
+            if (dpy->init(0, NULL) != STATUS_OK)
+            {
+                delete dpy;
+                return NULL;
+            }
+
+            if (!check_headless_backend(dpy))
+            {
+                lsp_error("Window system calls are not dispatched to the headless backend");
+                dpy->destroy();
+                delete dpy;
+                return NULL;
+            }
+
+            return dpy;
+        }
+
+        void destroy_all(tk::Display *dpy, lltl::parray<tk::Widget> *widgets)
+        {
+            if (widgets != NULL)
+            {
+                tk::Widget *w;
+                while ((w = widgets->pop()) != NULL)
+                {
+                    w->destroy();
+                    delete w;
+                }
+                widgets->flush();
+            }
+
+            if (dpy != NULL)
+            {
+                dpy->destroy();
+                delete dpy;
+            }
+        }
+
+        void layout_widget(tk::Widget *w, ssize_t width, ssize_t height)
+        {
+            ws::size_limit_t sr;
+            ws::rectangle_t r;
+
+            r.nLeft     = 0;
+            r.nTop      = 0;
+            r.nWidth    = width;
+            r.nHeight   = height;
+
+            w->get_padded_size_limits(&sr);
+            w->realize_widget(&r);
+        }
+
+        void render_widget(tk::Widget *w, ws::ISurface *s)
+        {
+            ws::rectangle_t r;
+            w->get_rectangle(&r);
+
+            s->begin();
+                w->render(s, &r, true);
+            s->end();
+            w->commit_redraw();
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+#define NUM_ITEMS           100000
+#define AREA_WIDTH          320
+#define AREA_HEIGHT         480
+
+PTEST_BEGIN("tk.widgets.compound", listbox, 5, 100)
+
+    PTEST_MAIN
+    {
+        LSPString text;
+        lltl::parray<tk::Widget> widgets;
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        tk::ListBox *lb = new tk::ListBox(dpy);
+        PTEST_ASSERT(lb != NULL);
+        PTEST_ASSERT(widgets.add(lb));
+        PTEST_ASSERT(lb->init() == STATUS_OK);
+
+        tk::ListBox *db = new tk::ListBox(dpy);
+        PTEST_ASSERT(db != NULL);
+        PTEST_ASSERT(widgets.add(db));
+        PTEST_ASSERT(db->init() == STATUS_OK);
+
+        printf("Filling list box with %d items...\n", int(NUM_ITEMS));
+        for (size_t i=0; i<NUM_ITEMS; ++i)
+        {
+            tk::ListBoxItem *li = new tk::ListBoxItem(dpy);
+            PTEST_ASSERT(li != NULL);
+            PTEST_ASSERT(widgets.add(li));
+            PTEST_ASSERT(li->init() == STATUS_OK);
+            PTEST_ASSERT(text.fmt_ascii("List item %d", int(i)));
+            PTEST_ASSERT(li->text()->set_raw(&text) == STATUS_OK);
+            PTEST_ASSERT(lb->items()->add(li) == STATUS_OK);
+        }
+
+        printf("Filling list box with %d data items...\n", int(NUM_ITEMS));
+        PTEST_ASSERT(db->data_items()->reserve(NUM_ITEMS) == STATUS_OK);
+        for (size_t i=0; i<NUM_ITEMS; ++i)
+        {
+            PTEST_ASSERT(text.fmt_ascii("List item %d", int(i)));
+            PTEST_ASSERT(db->data_items()->add(&text, i) == STATUS_OK);
+        }
+
+        ws::ISurface *s = dpy->create_surface(AREA_WIDTH, AREA_HEIGHT);
+        PTEST_ASSERT(s != NULL);
+
+        printf("Testing list box layout...\n");
+        PTEST_LOOP("layout 100k",
+            lb->query_resize();
+            test::layout_widget(lb, AREA_WIDTH, AREA_HEIGHT);
+        );
+
+        printf("Testing list box scrolling and rendering...\n");
+        size_t step = 0;
+        PTEST_LOOP("scroll+render 100k",
+            lb->vscroll()->set((step++ % NUM_ITEMS) * 4.0f);
+            test::layout_widget(lb, AREA_WIDTH, AREA_HEIGHT);
+            test::render_widget(lb, s);
+        );
+
+        printf("Testing list box layout with data items...\n");
+        PTEST_LOOP("layout 100k data",
+            db->query_resize();
+            test::layout_widget(db, AREA_WIDTH, AREA_HEIGHT);
+        );
+
+        printf("Testing list box scrolling and rendering with data items...\n");
+        step = 0;
+        PTEST_LOOP("scroll+render 100k data",
+            db->vscroll()->set((step++ % NUM_ITEMS) * 4.0f);
+            test::layout_widget(db, AREA_WIDTH, AREA_HEIGHT);
+            test::render_widget(db, s);
+        );
+
+        s->destroy();
+        delete s;
+        test::destroy_all(dpy, &widgets);
+    }
+
+PTEST_END
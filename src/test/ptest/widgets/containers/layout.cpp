@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+#define AREA_WIDTH          1280
+#define AREA_HEIGHT         1024
+
+PTEST_BEGIN("tk.widgets.containers", layout, 5, 100)
+
+    tk::Grid *create_grid(tk::Display *dpy, lltl::parray<tk::Widget> &widgets, size_t rows, size_t cols)
+    {
+        tk::Grid *grid = test::create<tk::Grid>(dpy, &widgets);
+        if (grid == NULL)
+            return NULL;
+        grid->rows()->set(rows);
+        grid->columns()->set(cols);
+        grid->hspacing()->set(1);
+        grid->vspacing()->set(1);
+
+        for (size_t i=0, n=rows*cols; i<n; ++i)
+        {
+            tk::Void *v = test::create<tk::Void>(dpy, &widgets);
+            if ((v == NULL) || (grid->add(v) != STATUS_OK))
+                return NULL;
+            v->constraints()->set_min(4, 4);
+        }
+
+        return grid;
+    }
+
+    tk::Box *create_box(tk::Display *dpy, lltl::parray<tk::Widget> &widgets, size_t depth, size_t width, bool horizontal)
+    {
+        tk::Box *box = test::create<tk::Box>(dpy, &widgets);
+        if (box == NULL)
+            return NULL;
+        box->orientation()->set((horizontal) ? tk::O_HORIZONTAL : tk::O_VERTICAL);
+        box->spacing()->set(1);
+
+        for (size_t i=0; i<width; ++i)
+        {
+            tk::Widget *w;
+            if (depth > 1)
+                w = create_box(dpy, widgets, depth - 1, width, !horizontal);
+            else
+            {
+                tk::Void *v = test::create<tk::Void>(dpy, &widgets);
+                if (v != NULL)
+                    v->constraints()->set_min(2, 2);
+                w = v;
+            }
+            if ((w == NULL) || (box->add(w) != STATUS_OK))
+                return NULL;
+        }
+
+        return box;
+    }
+
+    void call(const char *label, tk::Widget *w)
+    {
+        char buf[80];
+        PTEST_ASSERT(w != NULL);
+
+        snprintf(buf, sizeof(buf), "%s full layout", label);
+        printf("Testing %s...\n", buf);
+        PTEST_LOOP(buf,
+            w->query_resize();
+            test::layout_widget(w, AREA_WIDTH, AREA_HEIGHT);
+        );
+
+        snprintf(buf, sizeof(buf), "%s relayout", label);
+        printf("Testing %s...\n", buf);
+        PTEST_LOOP(buf,
+            test::layout_widget(w, AREA_WIDTH, AREA_HEIGHT);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        lltl::parray<tk::Widget> widgets;
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        call("grid 32x32", create_grid(dpy, widgets, 32, 32));
+        PTEST_SEPARATOR;
+        call("grid 128x128", create_grid(dpy, widgets, 128, 128));
+        PTEST_SEPARATOR;
+        call("box 10x10x10", create_box(dpy, widgets, 3, 10, true));
+        PTEST_SEPARATOR;
+        call("box 8x8x8x8", create_box(dpy, widgets, 4, 8, false));
+
+        test::destroy_all(dpy, &widgets);
+    }
+
+PTEST_END
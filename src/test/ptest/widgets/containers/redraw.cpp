@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+#define AREA_WIDTH          1280
+#define AREA_HEIGHT         1024
+#define TREE_DEPTH          5
+
+PTEST_BEGIN("tk.widgets.containers", redraw, 5, 1000)
+
+    tk::Box *create_box(tk::Display *dpy, lltl::parray<tk::Widget> &widgets, lltl::parray<tk::Widget> &leaves,
+        size_t depth, size_t width, bool horizontal)
+    {
+        tk::Box *box = test::create<tk::Box>(dpy, &widgets);
+        if (box == NULL)
+            return NULL;
+        box->orientation()->set((horizontal) ? tk::O_HORIZONTAL : tk::O_VERTICAL);
+        box->spacing()->set(1);
+
+        for (size_t i=0; i<width; ++i)
+        {
+            tk::Widget *w;
+            if (depth > 1)
+                w = create_box(dpy, widgets, leaves, depth - 1, width, !horizontal);
+            else
+            {
+                tk::Void *v = test::create<tk::Void>(dpy, &widgets);
+                if ((v != NULL) && (!leaves.add(v)))
+                    return NULL;
+                w = v;
+            }
+            if ((w == NULL) || (box->add(w) != STATUS_OK))
+                return NULL;
+        }
+
+        return box;
+    }
+
+    void redraw(tk::Window *wnd, ws::ISurface *s, tk::Widget *leaf, bool force)
+    {
+        ws::rectangle_t r;
+        wnd->get_rectangle(&r);
+
+        leaf->query_draw();
+        s->begin();
+            wnd->render(s, &r, force);
+        s->end();
+        wnd->commit_redraw();
+    }
+
+    void call(tk::Display *dpy, size_t width)
+    {
+        lltl::parray<tk::Widget> widgets, leaves;
+        char buf[80];
+
+        tk::Window *wnd = test::create<tk::Window>(dpy, &widgets);
+        PTEST_ASSERT(wnd != NULL);
+        tk::Box *root = create_box(dpy, widgets, leaves, TREE_DEPTH, width, true);
+        PTEST_ASSERT(root != NULL);
+        PTEST_ASSERT(wnd->add(root) == STATUS_OK);
+        wnd->size()->set(AREA_WIDTH, AREA_HEIGHT);
+        wnd->visibility()->set(true);
+
+        // Map the window and render the first frame
+        for (size_t i=0; i<10; ++i)
+            dpy->main_iteration();
+
+        ws::ISurface *s = dpy->display()->create_surface(AREA_WIDTH, AREA_HEIGHT);
+        PTEST_ASSERT(s != NULL);
+        redraw(wnd, s, wnd, true);
+
+        size_t counter = 0;
+        size_t leaf_count = leaves.size();
+
+        snprintf(buf, sizeof(buf), "%d widgets full", int(widgets.size()));
+        printf("Testing %s...\n", buf);
+        PTEST_LOOP(buf,
+            redraw(wnd, s, leaves.uget((counter++) % leaf_count), true);
+        );
+
+        wnd->reset_render_stats();
+        snprintf(buf, sizeof(buf), "%d widgets dirty", int(widgets.size()));
+        printf("Testing %s...\n", buf);
+        PTEST_LOOP(buf,
+            redraw(wnd, s, leaves.uget((counter++) % leaf_count), false);
+        );
+
+        tk::Window::render_stats_t stats;
+        wnd->get_render_stats(&stats);
+        printf("Render stats: full=%d, partial=%d, dirty=%d\n",
+            int(stats.nFull), int(stats.nPartial), int(stats.nDirty));
+
+        s->destroy();
+        delete s;
+
+        // Destroy children before the window
+        for (size_t i=widgets.size(); i > 0; --i)
+        {
+            tk::Widget *w = widgets.uget(i - 1);
+            w->destroy();
+            delete w;
+        }
+        widgets.flush();
+        leaves.flush();
+    }
+
+    PTEST_MAIN
+    {
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        call(dpy, 3);
+        PTEST_SEPARATOR;
+        call(dpy, 4);
+        PTEST_SEPARATOR;
+        call(dpy, 5);
+
+        test::destroy_all(dpy, NULL);
+    }
+
+PTEST_END
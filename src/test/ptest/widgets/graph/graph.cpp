@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <private/ptest/tk/common.h>
+
+#define AREA_WIDTH          800
+#define AREA_HEIGHT         480
+#define MESH_SIZE           4096
+#define FB_ROWS             256
+#define FB_COLS             512
+#define FB_WIDE_COLS        2048
+#define FB_WIDE_ROWS        16
+
+PTEST_BEGIN("tk.widgets.graph", graph, 5, 100)
+
+    tk::Graph *create_graph(tk::Display *dpy, lltl::parray<tk::Widget> &widgets)
+    {
+        tk::Graph *gr = test::create<tk::Graph>(dpy, &widgets);
+        if (gr == NULL)
+            return NULL;
+
+        tk::GraphOrigin *go = test::create<tk::GraphOrigin>(dpy, &widgets, gr);
+        if (go == NULL)
+            return NULL;
+        go->left()->set(-1.0f);
+        go->top()->set(-1.0f);
+
+        tk::GraphAxis *ga = test::create<tk::GraphAxis>(dpy, &widgets, gr);
+        if (ga == NULL)
+            return NULL;
+        ga->min()->set(10);
+        ga->max()->set(24000);
+        ga->log_scale()->set(true);
+        ga->direction()->set_dangle(0);
+
+        ga = test::create<tk::GraphAxis>(dpy, &widgets, gr);
+        if (ga == NULL)
+            return NULL;
+        ga->min()->set(0);
+        ga->max()->set(120);
+        ga->direction()->set_dangle(90);
+
+        // Add markers
+        for (size_t i=0; i<32; ++i)
+        {
+            tk::GraphMarker *gm = test::create<tk::GraphMarker>(dpy, &widgets, gr);
+            if (gm == NULL)
+                return NULL;
+            gm->basis()->set(0);
+            gm->parallel()->set(1);
+            gm->value()->set(10.0f + i * 750.0f);
+        }
+
+        return gr;
+    }
+
+    PTEST_MAIN
+    {
+        lltl::parray<tk::Widget> widgets;
+        float *x = new float[MESH_SIZE];
+        float *y = new float[MESH_SIZE];
+        float *row = new float[FB_WIDE_COLS];
+        PTEST_ASSERT((x != NULL) && (y != NULL) && (row != NULL));
+
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+        ws::ISurface *s = dpy->create_surface(AREA_WIDTH, AREA_HEIGHT);
+        PTEST_ASSERT(s != NULL);
+
+        // Mesh rendering
+        {
+            tk::Graph *gr = create_graph(dpy, widgets);
+            PTEST_ASSERT(gr != NULL);
+            tk::GraphMesh *gm = test::create<tk::GraphMesh>(dpy, &widgets, gr);
+            PTEST_ASSERT(gm != NULL);
+            gm->haxis()->set(0);
+            gm->vaxis()->set(1);
+
+            for (size_t i=0; i<MESH_SIZE; ++i)
+                x[i] = 10.0f * expf(i * logf(2400.0f) / MESH_SIZE);
+
+            test::layout_widget(gr, AREA_WIDTH, AREA_HEIGHT);
+
+            size_t phase = 0;
+            printf("Testing rendering of GraphMesh with %d points...\n", int(MESH_SIZE));
+            PTEST_LOOP("mesh",
+                for (size_t i=0; i<MESH_SIZE; ++i)
+                    y[i] = 60.0f + 50.0f * sinf((i + phase) * 0.01f);
+                ++phase;
+                gm->data()->set_x(x, MESH_SIZE);
+                gm->data()->set_y(y, MESH_SIZE);
+                test::render_widget(gr, s);
+            );
+
+            printf("Testing rendering of static GraphMesh with %d points...\n", int(MESH_SIZE));
+            PTEST_LOOP("static mesh",
+                test::render_widget(gr, s);
+            );
+            gr->visibility()->set(false);
+        }
+
+        PTEST_SEPARATOR;
+
+        // Frame buffer rendering
+        {
+            tk::Graph *gr = create_graph(dpy, widgets);
+            PTEST_ASSERT(gr != NULL);
+            tk::GraphFrameBuffer *fb = test::create<tk::GraphFrameBuffer>(dpy, &widgets, gr);
+            PTEST_ASSERT(fb != NULL);
+            fb->data()->set_size(FB_ROWS, FB_COLS);
+            fb->hpos()->set(-1);
+            fb->vpos()->set(1);
+            fb->hscale()->set(1);
+            fb->vscale()->set(1);
+
+            test::layout_widget(gr, AREA_WIDTH, AREA_HEIGHT);
+
+            size_t phase = 0;
+            printf("Testing rendering of GraphFrameBuffer %dx%d...\n", int(FB_ROWS), int(FB_COLS));
+            PTEST_LOOP("framebuffer",
+                for (size_t i=0; i<FB_COLS; ++i)
+                    row[i] = 0.5f + 0.5f * sinf((i + phase) * 0.05f);
+                ++phase;
+                fb->data()->set_row(fb->data()->top(), row);
+                test::render_widget(gr, s);
+            );
+            gr->visibility()->set(false);
+        }
+
+        PTEST_SEPARATOR;
+
+        // Frame buffer row conversion: per-pixel HSLA computation against palette lookup
+        {
+            tk::Graph *gr = create_graph(dpy, widgets);
+            PTEST_ASSERT(gr != NULL);
+            tk::GraphFrameBuffer *fb = test::create<tk::GraphFrameBuffer>(dpy, &widgets, gr);
+            PTEST_ASSERT(fb != NULL);
+            fb->data()->set_size(FB_ROWS, FB_WIDE_COLS);
+
+            test::layout_widget(gr, AREA_WIDTH, AREA_HEIGHT);
+
+            static const ssize_t palettes[] = { 0, 1024, 4096, -1 };
+            char buf[80];
+            size_t phase = 0;
+
+            for (const ssize_t *pal = palettes; *pal >= 0; ++pal)
+            {
+                fb->palette_size()->set(*pal);
+                if (*pal > 0)
+                    snprintf(buf, sizeof(buf), "framebuffer lut %d", int(*pal));
+                else
+                    snprintf(buf, sizeof(buf), "framebuffer hsla");
+
+                printf("Testing conversion of %d rows x %d columns with %s...\n", int(FB_WIDE_ROWS), int(FB_WIDE_COLS), buf);
+                PTEST_LOOP(buf,
+                    for (size_t j=0; j<FB_WIDE_ROWS; ++j, ++phase)
+                    {
+                        for (size_t i=0; i<FB_WIDE_COLS; ++i)
+                            row[i] = 0.5f + 0.5f * sinf((i + phase) * 0.05f);
+                        fb->data()->set_row(fb->data()->top(), row);
+                    }
+                    test::render_widget(gr, s);
+                );
+            }
+        }
+
+        PTEST_SEPARATOR;
+
+        // Items with retained display lists
+        {
+            tk::Graph *gr = create_graph(dpy, widgets);
+            PTEST_ASSERT(gr != NULL);
+            tk::GraphDot *gd = test::create<tk::GraphDot>(dpy, &widgets, gr);
+            PTEST_ASSERT(gd != NULL);
+            gd->haxis()->set(0);
+            gd->vaxis()->set(1);
+            gd->vvalue()->set_all(60.0f, 0.0f, 120.0f);
+
+            test::layout_widget(gr, AREA_WIDTH, AREA_HEIGHT);
+
+            tk::Graph::draw_list_stats_t stats;
+            size_t phase = 0;
+            printf("Testing rendering of markers with moving dot...\n");
+            gr->reset_draw_list_stats();
+            PTEST_LOOP("moving dot",
+                gd->hvalue()->set_all(10.0f + (phase++ % 2400) * 10.0f, 10.0f, 24000.0f);
+                test::render_widget(gr, s);
+            );
+
+            gr->get_draw_list_stats(&stats);
+            printf("Display lists: recorded=%d, replayed=%d\n",
+                int(stats.nRecorded), int(stats.nReplayed));
+
+            printf("Testing rendering of markers and dot with display lists recorded...\n");
+            gr->reset_draw_list_stats();
+            PTEST_LOOP("recorded items",
+                // Invalidate the layout of the graph, so all items record their display lists
+                gr->query_static_draw();
+                test::render_widget(gr, s);
+            );
+
+            gr->get_draw_list_stats(&stats);
+            printf("Display lists: recorded=%d, replayed=%d\n",
+                int(stats.nRecorded), int(stats.nReplayed));
+            PTEST_ASSERT(stats.nRecorded > 0);
+            PTEST_ASSERT(stats.nReplayed == 0);
+
+            printf("Testing rendering of markers and dot with display lists replayed...\n");
+            gr->reset_draw_list_stats();
+            PTEST_LOOP("replayed items",
+                // Force the graph to redraw as if one of other items has changed
+                gr->query_draw();
+                test::render_widget(gr, s);
+            );
+
+            gr->get_draw_list_stats(&stats);
+            printf("Display lists: recorded=%d, replayed=%d\n",
+                int(stats.nRecorded), int(stats.nReplayed));
+            PTEST_ASSERT(stats.nReplayed > 0);
+            gr->visibility()->set(false);
+        }
+
+        s->destroy();
+        delete s;
+        test::destroy_all(dpy, &widgets);
+
+        delete [] x;
+        delete [] y;
+        delete [] row;
+    }
+
+PTEST_END
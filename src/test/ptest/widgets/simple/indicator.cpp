@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+#define NUM_INDICATORS      32
+#define AREA_WIDTH          160
+#define AREA_HEIGHT         32
+
+PTEST_BEGIN("tk.widgets.simple", indicator, 5, 1000)
+
+    PTEST_MAIN
+    {
+        lltl::parray<tk::Widget> widgets;
+        tk::Indicator *vi[NUM_INDICATORS];
+
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        for (size_t i=0; i<NUM_INDICATORS; ++i)
+        {
+            tk::Indicator *ind = new tk::Indicator(dpy);
+            PTEST_ASSERT(ind != NULL);
+            PTEST_ASSERT(widgets.add(ind));
+            PTEST_ASSERT(ind->init() == STATUS_OK);
+            ind->columns()->set(8);
+            ind->dark_text()->set(true);
+            vi[i] = ind;
+        }
+
+        ws::ISurface *s = dpy->create_surface(AREA_WIDTH, AREA_HEIGHT);
+        PTEST_ASSERT(s != NULL);
+        for (size_t i=0; i<NUM_INDICATORS; ++i)
+            test::layout_widget(vi[i], AREA_WIDTH, AREA_HEIGHT);
+
+        size_t phase = 0;
+        char text[32];
+        printf("Testing update of %d indicators...\n", int(NUM_INDICATORS));
+        PTEST_LOOP("update",
+            for (size_t i=0; i<NUM_INDICATORS; ++i)
+            {
+                snprintf(text, sizeof(text), "%02d:%02d.%02d",
+                    int((phase / 6000) % 60), int((phase / 100) % 60), int((phase + i) % 100));
+                vi[i]->text()->set_raw(text);
+                test::render_widget(vi[i], s);
+            }
+            ++phase;
+        );
+
+        s->destroy();
+        delete s;
+        test::destroy_all(dpy, &widgets);
+    }
+
+PTEST_END
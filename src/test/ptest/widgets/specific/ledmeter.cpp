@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <private/ptest/tk/common.h>
+
+#define NUM_CHANNELS        8
+#define AREA_WIDTH          320
+#define AREA_HEIGHT         256
+
+PTEST_BEGIN("tk.widgets.specific", ledmeter, 5, 1000)
+
+    PTEST_MAIN
+    {
+        lltl::parray<tk::Widget> widgets;
+        tk::LedMeterChannel *vc[NUM_CHANNELS];
+
+        tk::Display *dpy = test::create_headless_display();
+        PTEST_ASSERT(dpy != NULL);
+
+        tk::LedMeter *lm = new tk::LedMeter(dpy);
+        PTEST_ASSERT(lm != NULL);
+        PTEST_ASSERT(widgets.add(lm));
+        PTEST_ASSERT(lm->init() == STATUS_OK);
+        lm->text_visible()->set(true);
+        lm->header_visible()->set(true);
+
+        for (size_t i=0; i<NUM_CHANNELS; ++i)
+        {
+            tk::LedMeterChannel *lc = new tk::LedMeterChannel(dpy);
+            PTEST_ASSERT(lc != NULL);
+            PTEST_ASSERT(widgets.add(lc));
+            PTEST_ASSERT(lc->init() == STATUS_OK);
+            PTEST_ASSERT(lm->add(lc) == STATUS_OK);
+
+            lc->text_visible()->set(true);
+            lc->peak_visible()->set(true);
+            lc->value()->set_all(-48.0f, -48.0f, 6.0f);
+            lc->peak()->set(-48.0f);
+            vc[i] = lc;
+        }
+
+        ws::ISurface *s = dpy->create_surface(AREA_WIDTH, AREA_HEIGHT);
+        PTEST_ASSERT(s != NULL);
+        test::layout_widget(lm, AREA_WIDTH, AREA_HEIGHT);
+
+        size_t phase = 0;
+        char text[32];
+        printf("Testing animation of LedMeter with %d channels...\n", int(NUM_CHANNELS));
+        PTEST_LOOP("animation",
+            for (size_t i=0; i<NUM_CHANNELS; ++i)
+            {
+                float v = -48.0f + ((phase + i * 7) % 54);
+                vc[i]->value()->set(v);
+                vc[i]->peak()->set(v + 3.0f);
+                snprintf(text, sizeof(text), "%.1f", v);
+                vc[i]->text()->set_raw(text);
+            }
+            ++phase;
+            test::layout_widget(lm, AREA_WIDTH, AREA_HEIGHT);
+            test::render_widget(lm, s);
+        );
+
+        s->destroy();
+        delete s;
+        test::destroy_all(dpy, &widgets);
+    }
+
+PTEST_END
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+UTEST_BEGIN("tk.prop.collection", itemlist)
+
+    class Listener: public tk::prop::Listener
+    {
+        public:
+            size_t      nChanges;
+
+        public:
+            explicit Listener()         { nChanges = 0;     }
+
+        public:
+            virtual void notify(tk::Property *prop) override
+            {
+                ++nChanges;
+            }
+    };
+
+    UTEST_MAIN
+    {
+        Listener listener;
+        tk::prop::ItemList list(&listener);
+
+        // Add items
+        printf("Testing add of items...\n");
+        UTEST_ASSERT(list.add("first", 1) == STATUS_OK);
+        UTEST_ASSERT(list.add("second", 2, tk::IF_SELECTED) == STATUS_OK);
+        UTEST_ASSERT(list.add("third", 3, tk::IF_SELECTED | tk::IF_CHECKED) == STATUS_OK);
+        UTEST_ASSERT(list.add("fourth", 4, tk::IF_BG_COLOR) == STATUS_OK);
+        UTEST_ASSERT(list.insert(0, "zero", 0) == STATUS_OK);
+        UTEST_ASSERT(list.insert(10, "bad", 10) != STATUS_OK);
+        UTEST_ASSERT(listener.nChanges == 5);
+
+        UTEST_ASSERT(list.size() == 5);
+        UTEST_ASSERT(strcmp(list.text(0), "zero") == 0);
+        UTEST_ASSERT(strcmp(list.text(2), "second") == 0);
+        UTEST_ASSERT(list.text(5) == NULL);
+        UTEST_ASSERT(list.tag(3) == 3);
+        UTEST_ASSERT(list.tag(5) == -1);
+        UTEST_ASSERT(list.find_tag(4) == 4);
+        UTEST_ASSERT(list.find_tag(5) < 0);
+
+        // Flags outside of user mask are not accepted
+        UTEST_ASSERT(list.flags(4) == 0);
+        UTEST_ASSERT(list.flags(3) == (tk::IF_SELECTED | tk::IF_CHECKED));
+        UTEST_ASSERT(list.find_flags(tk::IF_SELECTED) == 2);
+        UTEST_ASSERT(list.find_flags(tk::IF_SELECTED, 3) == 3);
+        UTEST_ASSERT(list.find_flags(tk::IF_SELECTED, 4) < 0);
+
+        // Modify flags without notification
+        printf("Testing modification of flags...\n");
+        listener.nChanges = 0;
+        UTEST_ASSERT(list.set_flags(0, tk::IF_SELECTED, false) == STATUS_OK);
+        UTEST_ASSERT(list.flags(0) == tk::IF_SELECTED);
+        UTEST_ASSERT(listener.nChanges == 0);
+        UTEST_ASSERT(list.set_flags(5, tk::IF_SELECTED) != STATUS_OK);
+
+        // Color override flags are kept
+        lsp::Color c;
+        c.set_rgb24(0x112233);
+        UTEST_ASSERT(list.set_bg_color(4, &c) == STATUS_OK);
+        UTEST_ASSERT(list.set_flags(4, tk::IF_SELECTED) == STATUS_OK);
+        UTEST_ASSERT(listener.nChanges == 2);
+        UTEST_ASSERT(list.get_bg_color(&c, 4));
+        UTEST_ASSERT(c.rgb24() == 0x112233);
+        UTEST_ASSERT(!list.get_text_color(&c, 4));
+
+        // Color overrides keep the alpha channel
+        c.set_rgba32(0x80445566);
+        UTEST_ASSERT(list.set_text_color(4, &c) == STATUS_OK);
+        c.set_rgba32(0);
+        UTEST_ASSERT(list.get_text_color(&c, 4));
+        UTEST_ASSERT(c.rgba32() == 0x80445566);
+
+        // Clear selection without notification
+        printf("Testing clear of selection...\n");
+        listener.nChanges = 0;
+        UTEST_ASSERT(list.clear_flags(tk::IF_SELECTED, false));
+        UTEST_ASSERT(listener.nChanges == 0);
+        UTEST_ASSERT(list.find_flags(tk::IF_SELECTED) < 0);
+        UTEST_ASSERT(list.flags(3) == tk::IF_CHECKED);
+        UTEST_ASSERT(list.get_bg_color(&c, 4));
+        UTEST_ASSERT(!list.clear_flags(tk::IF_SELECTED));
+        UTEST_ASSERT(listener.nChanges == 0);
+
+        // Clear selection with notification
+        UTEST_ASSERT(list.set_flags(1, tk::IF_SELECTED, false) == STATUS_OK);
+        UTEST_ASSERT(list.clear_flags(tk::IF_SELECTED));
+        UTEST_ASSERT(listener.nChanges == 1);
+        UTEST_ASSERT(list.flags(1) == 0);
+
+        // Remove items
+        printf("Testing remove of items...\n");
+        listener.nChanges = 0;
+        UTEST_ASSERT(list.remove(0) == STATUS_OK);
+        UTEST_ASSERT(list.remove(10) != STATUS_OK);
+        UTEST_ASSERT(list.size() == 4);
+        UTEST_ASSERT(strcmp(list.text(0), "first") == 0);
+        UTEST_ASSERT(list.find_tag(0) < 0);
+        UTEST_ASSERT(list.find_flags(tk::IF_CHECKED) == 2);
+        UTEST_ASSERT(listener.nChanges == 1);
+
+        // Clear the list
+        list.clear();
+        UTEST_ASSERT(list.size() == 0);
+        UTEST_ASSERT(listener.nChanges == 2);
+        list.clear();
+        UTEST_ASSERT(listener.nChanges == 2);
+
+        list.flush();
+    }
+
+UTEST_END
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/tk/tk.h>
+
+namespace
+{
+    static const float x_data[] =   { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f };
+    static const float y_data[] =   { 1.0f, 0.5f, 0.25f, 0.125f, 0.0f, -0.125f, -0.25f, -0.5f };
+}
+
+UTEST_BEGIN("tk.prop.specific", graphmeshdata)
+
+    bool check_data(const float *v, const float *data, size_t count)
+    {
+        if (v == NULL)
+            return false;
+        for (size_t i=0; i<count; ++i)
+            if (!float_equals_adaptive(v[i], data[i]))
+                return false;
+        return true;
+    }
+
+    UTEST_MAIN
+    {
+        tk::prop::GraphMeshData md;
+        float ext_x[8], ext_y[8];
+        const tk::GraphMeshData *cmd = &md;
+
+        for (size_t i=0; i<8; ++i)
+        {
+            ext_x[i]    = x_data[i];
+            ext_y[i]    = y_data[i];
+        }
+
+        // Copy data
+        printf("Testing copy of data...\n");
+        size_t version = md.version();
+        UTEST_ASSERT(md.set(x_data, y_data, 8));
+        UTEST_ASSERT(md.version() != version);
+        UTEST_ASSERT(!md.attached());
+        UTEST_ASSERT(md.size() == 8);
+        UTEST_ASSERT(cmd->x() != x_data);
+        UTEST_ASSERT(check_data(cmd->x(), x_data, 8));
+        UTEST_ASSERT(check_data(cmd->y(), y_data, 8));
+
+        // Attach external buffers
+        printf("Testing attach of external buffers...\n");
+        version = md.version();
+        UTEST_ASSERT(md.attach(ext_x, ext_y, 4));
+        UTEST_ASSERT(md.version() != version);
+        UTEST_ASSERT(md.attached());
+        UTEST_ASSERT(md.valid());
+        UTEST_ASSERT(!md.strobe());
+        UTEST_ASSERT(md.size() == 4);
+        UTEST_ASSERT(cmd->x() == ext_x);
+        UTEST_ASSERT(cmd->y() == ext_y);
+        UTEST_ASSERT(cmd->s() == NULL);
+
+        // Modify external buffers in place
+        printf("Testing modification of external buffers...\n");
+        ext_y[0]    = 2.0f;
+        version     = md.version();
+        md.touch();
+        UTEST_ASSERT(md.version() != version);
+        UTEST_ASSERT(cmd->y() == ext_y);
+        UTEST_ASSERT(float_equals_adaptive(cmd->y()[0], 2.0f));
+
+        // Detach by obtaining the writable pointer
+        printf("Testing detach of external buffers...\n");
+        float *y    = md.y();
+        UTEST_ASSERT(y != NULL);
+        UTEST_ASSERT(y != ext_y);
+        UTEST_ASSERT(!md.attached());
+        UTEST_ASSERT(md.size() == 4);
+        UTEST_ASSERT(check_data(cmd->x(), x_data, 4));
+        UTEST_ASSERT(check_data(cmd->y(), ext_y, 4));
+
+        // Re-attach and resize
+        printf("Testing resize of attached buffers...\n");
+        UTEST_ASSERT(md.attach(ext_x, ext_y, 8));
+        UTEST_ASSERT(md.set_size(6));
+        UTEST_ASSERT(!md.attached());
+        UTEST_ASSERT(md.size() == 6);
+        UTEST_ASSERT(check_data(cmd->x(), x_data, 6));
+        UTEST_ASSERT(check_data(cmd->y(), ext_y, 6));
+    }
+
+UTEST_END
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+UTEST_BEGIN("tk.style", prototype)
+
+    class CountingListener: public tk::IStyleListener
+    {
+        public:
+            size_t      nCount;
+
+        public:
+            explicit CountingListener()     { nCount = 0;   }
+
+        public:
+            virtual void notify(tk::atom_t property) override
+            {
+                ++nCount;
+            }
+    };
+
+    UTEST_MAIN
+    {
+        tk::Atoms atoms;
+        tk::Schema schema(&atoms, NULL);
+        tk::Style parent(&schema, NULL, NULL);
+        tk::Style proto(&schema, NULL, NULL);
+        tk::Style clone(&schema, NULL, NULL);
+        CountingListener lp[3], lc[3];
+        ssize_t iv;
+        const char *sv;
+
+        tk::atom_t a_int    = atoms.atom_id("int");
+        tk::atom_t a_local  = atoms.atom_id("local");
+        tk::atom_t a_str    = atoms.atom_id("str");
+
+        // Initialize parent and prototype
+        printf("Initializing prototype...\n");
+        UTEST_ASSERT(parent.set_int(a_int, 10) == STATUS_OK);
+        UTEST_ASSERT(parent.set_string(a_str, "hello") == STATUS_OK);
+
+        UTEST_ASSERT(proto.bind_int(a_int, &lp[0]) == STATUS_OK);
+        UTEST_ASSERT(proto.bind_int(a_local, &lp[1]) == STATUS_OK);
+        UTEST_ASSERT(proto.bind_string(a_str, &lp[2]) == STATUS_OK);
+        UTEST_ASSERT(proto.add_parent(&parent) == STATUS_OK);
+        UTEST_ASSERT(proto.set_int(a_local, 5) == STATUS_OK);
+
+        // Bind clone using the prototype, values should be taken from the prototype
+        printf("Binding clone...\n");
+        UTEST_ASSERT(clone.set_prototype(&proto) == STATUS_OK);
+        UTEST_ASSERT(clone.bind_int(a_int, &lc[0]) == STATUS_OK);
+        UTEST_ASSERT(clone.bind_int(a_local, &lc[1]) == STATUS_OK);
+        UTEST_ASSERT(clone.bind_string(a_str, &lc[2]) == STATUS_OK);
+        UTEST_ASSERT(clone.set_prototype(NULL) == STATUS_OK);
+
+        UTEST_ASSERT(clone.get_int(a_int, &iv) == STATUS_OK);
+        UTEST_ASSERT(iv == 10);
+        UTEST_ASSERT(clone.get_int(a_local, &iv) == STATUS_OK);
+        UTEST_ASSERT(iv == 5);
+        UTEST_ASSERT(clone.get_string(a_str, &sv) == STATUS_OK);
+        UTEST_ASSERT(strcmp(sv, "hello") == 0);
+        UTEST_ASSERT(clone.is_overridden(a_local));
+        UTEST_ASSERT(!clone.is_overridden(a_int));
+
+        // Attaching the same parent should not cause any changes
+        printf("Attaching parent to clone...\n");
+        for (size_t i=0; i<3; ++i)
+            lc[i].nCount    = 0;
+        UTEST_ASSERT(clone.add_parent(&parent) == STATUS_OK);
+        for (size_t i=0; i<3; ++i)
+            UTEST_ASSERT(lc[i].nCount == 0);
+
+        // Clone should follow the parent as usual
+        printf("Changing parent...\n");
+        UTEST_ASSERT(parent.set_int(a_int, 20) == STATUS_OK);
+        UTEST_ASSERT(clone.get_int(a_int, &iv) == STATUS_OK);
+        UTEST_ASSERT(iv == 20);
+        UTEST_ASSERT(lc[0].nCount == 1);
+
+        // Changed prototype should provide new values
+        printf("Changing prototype...\n");
+        tk::Style clone2(&schema, NULL, NULL);
+        CountingListener lc2;
+        UTEST_ASSERT(proto.set_int(a_local, 7) == STATUS_OK);
+        UTEST_ASSERT(clone2.set_prototype(&proto) == STATUS_OK);
+        UTEST_ASSERT(clone2.bind_int(a_local, &lc2) == STATUS_OK);
+        UTEST_ASSERT(clone2.set_prototype(NULL) == STATUS_OK);
+        UTEST_ASSERT(clone2.get_int(a_local, &iv) == STATUS_OK);
+        UTEST_ASSERT(iv == 7);
+
+        // Unbind listeners
+        UTEST_ASSERT(clone2.unbind(a_local, &lc2) == STATUS_OK);
+        UTEST_ASSERT(clone.unbind(a_int, &lc[0]) == STATUS_OK);
+        UTEST_ASSERT(clone.unbind(a_local, &lc[1]) == STATUS_OK);
+        UTEST_ASSERT(clone.unbind(a_str, &lc[2]) == STATUS_OK);
+        UTEST_ASSERT(proto.unbind(a_int, &lp[0]) == STATUS_OK);
+        UTEST_ASSERT(proto.unbind(a_local, &lp[1]) == STATUS_OK);
+        UTEST_ASSERT(proto.unbind(a_str, &lp[2]) == STATUS_OK);
+    }
+
+UTEST_END
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+UTEST_BEGIN("tk.style", recolor)
+
+    class CountingListener: public tk::IStyleListener
+    {
+        public:
+            size_t      nCount;
+
+        public:
+            explicit CountingListener()     { nCount = 0;   }
+
+        public:
+            virtual void notify(tk::atom_t property) override
+            {
+                ++nCount;
+            }
+    };
+
+    void apply_sheet(tk::Schema *schema, const char *bg, const char *bg_alt)
+    {
+        LSPString text;
+        tk::StyleSheet sheet;
+
+        UTEST_ASSERT(text.fmt_utf8(
+            "<schema>"
+                "<colors>"
+                    "<bg value=\"%s\" />"
+                    "<bg_alt value=\"%s\" />"
+                "</colors>"
+                "<style class=\"Test\" parents=\"root\">"
+                    "<color value=\"bg_alt\" />"
+                "</style>"
+            "</schema>",
+            bg, bg_alt) > 0);
+        UTEST_ASSERT(sheet.parse_data(&text) == STATUS_OK);
+        UTEST_ASSERT(schema->apply(&sheet) == STATUS_OK);
+    }
+
+    UTEST_MAIN
+    {
+        tk::Atoms atoms;
+        tk::Schema schema(&atoms, NULL);
+        CountingListener listener;
+        const char *sv;
+
+        UTEST_ASSERT(schema.init(static_cast<tk::IStyleFactory **>(NULL), 0) == STATUS_OK);
+        tk::atom_t a_color  = atoms.atom_id("color");
+
+        printf("Applying initial sheet...\n");
+        apply_sheet(&schema, "#111111", "#222222");
+        tk::Style *style    = schema.get("Test");
+        UTEST_ASSERT(style != NULL);
+        UTEST_ASSERT(style->bind_string(a_color, &listener) == STATUS_OK);
+        UTEST_ASSERT(style->get_string(a_color, &sv) == STATUS_OK);
+        UTEST_ASSERT(strcmp(sv, "bg_alt") == 0);
+
+        // 'bg' is a prefix of 'bg_alt' but the property does not reference it
+        printf("Changing unrelated color...\n");
+        listener.nCount     = 0;
+        apply_sheet(&schema, "#333333", "#222222");
+        UTEST_ASSERT(listener.nCount == 0);
+
+        // Changing the referenced color should notify the listener
+        printf("Changing referenced color...\n");
+        apply_sheet(&schema, "#333333", "#444444");
+        UTEST_ASSERT(listener.nCount == 1);
+
+        UTEST_ASSERT(style->unbind(a_color, &listener) == STATUS_OK);
+    }
+
+UTEST_END
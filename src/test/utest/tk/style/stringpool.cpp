@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace lsp;
+
+UTEST_BEGIN("tk.style", stringpool)
+
+    void test_detached_style()
+    {
+        printf("Testing styles which outlive the schema...\n");
+
+        tk::Atoms atoms;
+        const char *sv;
+        tk::atom_t a_str    = atoms.atom_id("str");
+        tk::atom_t a_own    = atoms.atom_id("own");
+
+        tk::Schema *schema  = new tk::Schema(&atoms, NULL);
+        UTEST_ASSERT(schema != NULL);
+        tk::Style *parent   = new tk::Style(schema, NULL, NULL);
+        tk::Style *style    = new tk::Style(schema, NULL, NULL);
+        tk::Style *clone    = new tk::Style(schema, NULL, NULL);
+        UTEST_ASSERT((parent != NULL) && (style != NULL) && (clone != NULL));
+
+        UTEST_ASSERT(parent->set_string(a_str, "parent value") == STATUS_OK);
+        UTEST_ASSERT(style->add_parent(parent) == STATUS_OK);
+        UTEST_ASSERT(style->set_string(a_own, "own value") == STATUS_OK);
+        UTEST_ASSERT(clone->set_prototype(style) == STATUS_OK);
+        UTEST_ASSERT(style->get_string(a_str, &sv) == STATUS_OK);
+        UTEST_ASSERT(::strcmp(sv, "parent value") == 0);
+
+        // Styles should release interned strings and forget the schema
+        delete schema;
+        UTEST_ASSERT(parent->schema() == NULL);
+        UTEST_ASSERT(style->schema() == NULL);
+        UTEST_ASSERT(clone->schema() == NULL);
+        UTEST_ASSERT(style->get_string(a_own, &sv) == STATUS_OK);
+        UTEST_ASSERT(sv == tk::StringPool::empty());
+        UTEST_ASSERT(style->set_string(a_own, "value") == STATUS_BAD_STATE);
+
+        // Styles can be safely destroyed after the schema
+        delete parent;
+        delete style;
+        delete clone;
+    }
+
+    UTEST_MAIN
+    {
+        tk::StringPool pool;
+        char buf[64];
+
+        // Empty strings are not stored
+        const char *e   = pool.intern("");
+        UTEST_ASSERT(e == tk::StringPool::empty());
+        UTEST_ASSERT(pool.size() == 0);
+
+        // Equal strings share the same storage
+        ::strcpy(buf, "some value");
+        const char *s1  = pool.intern("some value");
+        const char *s2  = pool.intern(buf);
+        const char *s3  = pool.intern("other value");
+        UTEST_ASSERT(s1 != NULL);
+        UTEST_ASSERT(s3 != NULL);
+        UTEST_ASSERT(s1 == s2);
+        UTEST_ASSERT(s1 != buf);
+        UTEST_ASSERT(s1 != s3);
+        UTEST_ASSERT(::strcmp(s1, "some value") == 0);
+        UTEST_ASSERT(::strcmp(s3, "other value") == 0);
+        UTEST_ASSERT(pool.size() == 2);
+        UTEST_ASSERT(pool.references() == 3);
+        UTEST_ASSERT(pool.acquire(s3) == s3);
+        UTEST_ASSERT(pool.references() == 4);
+
+        // Release strings
+        pool.release(s1);
+        UTEST_ASSERT(pool.size() == 2);
+        pool.release(s2);
+        UTEST_ASSERT(pool.size() == 1);
+        pool.release(s3);
+        pool.release(s3);
+        pool.release(e);
+        UTEST_ASSERT(pool.size() == 0);
+        UTEST_ASSERT(pool.references() == 0);
+
+        // Grow the pool
+        for (size_t i=0; i<1000; ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "string %d", int(i));
+            UTEST_ASSERT(pool.intern(buf) != NULL);
+        }
+        UTEST_ASSERT(pool.size() == 1000);
+        for (size_t i=0; i<1000; ++i)
+        {
+            ::snprintf(buf, sizeof(buf), "string %d", int(i));
+            const char *s = pool.intern(buf);
+            UTEST_ASSERT(::strcmp(s, buf) == 0);
+            pool.release(s);
+            pool.release(s);
+        }
+        UTEST_ASSERT(pool.size() == 0);
+
+        pool.destroy();
+
+        test_detached_style();
+    }
+
+UTEST_END
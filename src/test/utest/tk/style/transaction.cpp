@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+using namespace lsp;
+using namespace lsp::tk;
+
+namespace
+{
+    using namespace lsp::tk;
+
+    // TestBase style
+    LSP_TK_STYLE_DEF_BEGIN(TestBase, Style)
+        prop::Integer       sInt;
+    LSP_TK_STYLE_DEF_END
+
+    LSP_TK_STYLE_IMPL_BEGIN(TestBase, Style)
+        // Bind
+        sInt.bind("int", this);
+
+        // Init
+        sInt.set(440);
+    LSP_TK_STYLE_IMPL_END
+
+    // TestChild nested style
+    LSP_TK_STYLE_DEF_BEGIN(TestChild, TestBase)
+    LSP_TK_STYLE_DEF_END
+
+    LSP_TK_STYLE_IMPL_BEGIN(TestChild, TestBase)
+    LSP_TK_STYLE_IMPL_END
+
+    StyleFactory<TestBase>  TestBaseFactory("TestBase", "root");
+    StyleFactory<TestChild> TestChildFactory("TestChild", "TestBase");
+
+    static IStyleFactory *init_list[] =
+    {
+        &TestBaseFactory,
+        &TestChildFactory
+    };
+}
+
+UTEST_BEGIN("tk.style", transaction)
+    class StyleClient
+    {
+        protected:
+            class Listener: public prop::Listener
+            {
+                private:
+                    StyleClient *pClient;
+
+                public:
+                    explicit Listener(StyleClient *ptr) : pClient(ptr) {}
+
+                public:
+                    virtual void notify(Property *prop)
+                    {
+                        if (pClient != NULL)
+                            pClient->property_changed(prop);
+                    }
+            };
+
+        protected:
+            Listener                        sListener;
+            Schema                         *pSchema;
+            Style                           sStyle;
+            const char                     *pParent;
+            lltl::parray<StyleClient>      *pLog;
+
+            prop::Integer                   sInt;
+            prop::Float                     sScaling;
+
+        public:
+            size_t                          nInt;
+            size_t                          nScaling;
+
+        public:
+            StyleClient(const char *style, Schema *schema, lltl::parray<StyleClient> *log):
+                sListener(this),
+                sStyle(schema, NULL, NULL),
+                sInt(&sListener),
+                sScaling(&sListener)
+            {
+                pSchema     = schema;
+                pParent     = style;
+                pLog        = log;
+                nInt        = 0;
+                nScaling    = 0;
+            }
+
+            virtual ~StyleClient()
+            {
+            }
+
+        public:
+            status_t init()
+            {
+                status_t res = sStyle.init();
+                if (res != STATUS_OK)
+                    return res;
+
+                sInt.bind("int", &sStyle);
+                sScaling.bind("size.scaling", &sStyle);
+
+                // Bind parent style class
+                Style *parent = pSchema->get(pParent);
+                if (parent == NULL)
+                    return STATUS_CORRUPTED;
+                return sStyle.add_parent(parent);
+            }
+
+            void reset()
+            {
+                nInt        = 0;
+                nScaling    = 0;
+            }
+
+            virtual void property_changed(Property *prop)
+            {
+                if (sInt.is(prop))
+                    ++nInt;
+                if (sScaling.is(prop))
+                {
+                    ++nScaling;
+                    pLog->add(this);
+                }
+            }
+
+        public:
+            LSP_TK_PROPERTY(Integer,        ivalue,         &sInt);
+            LSP_TK_PROPERTY(Float,          scaling,        &sScaling);
+
+            Style *style()      { return &sStyle; }
+    };
+
+    class KillerClient: public StyleClient
+    {
+        public:
+            StyleClient                    *pVictim;
+
+        public:
+            KillerClient(const char *style, Schema *schema, lltl::parray<StyleClient> *log):
+                StyleClient(style, schema, log)
+            {
+                pVictim     = NULL;
+            }
+
+        public:
+            virtual void property_changed(Property *prop) override
+            {
+                StyleClient::property_changed(prop);
+
+                // Destroy the client which is pending for notification in the same batch
+                if ((sInt.is(prop)) && (pVictim != NULL))
+                {
+                    delete pVictim;
+                    pVictim     = NULL;
+                }
+            }
+    };
+
+    UTEST_MAIN
+    {
+        Atoms sAtoms;
+        Schema sSchema(&sAtoms, NULL);
+        lltl::parray<StyleClient> log;
+
+        // Create default styles
+        UTEST_ASSERT(sSchema.init(init_list, sizeof(init_list)/sizeof(IStyleFactory *)) == STATUS_OK);
+
+        // Bind clients
+        StyleClient c1("TestChild", &sSchema, &log);
+        StyleClient c2("TestBase", &sSchema, &log);
+
+        UTEST_ASSERT(c1.init() == STATUS_OK);
+        UTEST_ASSERT(c2.init() == STATUS_OK);
+
+        Style *root = sSchema.root();
+        Style *base = sSchema.get("TestBase");
+        UTEST_ASSERT(root != NULL);
+        UTEST_ASSERT(base != NULL);
+
+        // Perform multiple changes without transaction
+        c1.reset();
+        c2.reset();
+        UTEST_ASSERT(base->set_int("int", 1000) == STATUS_OK);
+        UTEST_ASSERT(base->set_int("int", 2000) == STATUS_OK);
+        printf("Without transaction: c1.int notified %d times, c2.int notified %d times\n", int(c1.nInt), int(c2.nInt));
+        UTEST_ASSERT(c1.nInt == 2);
+        UTEST_ASSERT(c2.nInt == 2);
+
+        // Perform multiple changes in transaction
+        c1.reset();
+        c2.reset();
+        log.clear();
+        UTEST_ASSERT(sSchema.begin() == STATUS_OK);
+        {
+            UTEST_ASSERT(sSchema.in_transaction());
+            UTEST_ASSERT(base->set_int("int", 3000) == STATUS_OK);
+            UTEST_ASSERT(base->set_int("int", 4000) == STATUS_OK);
+            UTEST_ASSERT(root->set_float("size.scaling", 1.5f) == STATUS_OK);
+
+            // Nested transaction should not deliver notifications
+            UTEST_ASSERT(sSchema.begin() == STATUS_OK);
+                UTEST_ASSERT(root->set_float("size.scaling", 2.0f) == STATUS_OK);
+            UTEST_ASSERT(sSchema.end() == STATUS_OK);
+
+            UTEST_ASSERT(c1.nInt == 0);
+            UTEST_ASSERT(c2.nInt == 0);
+            UTEST_ASSERT(c1.nScaling == 0);
+            UTEST_ASSERT(c2.nScaling == 0);
+        }
+        UTEST_ASSERT(sSchema.end() == STATUS_OK);
+        UTEST_ASSERT(!sSchema.in_transaction());
+        UTEST_ASSERT(sSchema.end() != STATUS_OK);
+
+        // Each listener should be notified once with the final value
+        printf("In transaction: c1.int notified %d times, c2.int notified %d times\n", int(c1.nInt), int(c2.nInt));
+        printf("In transaction: c1.scaling notified %d times, c2.scaling notified %d times\n", int(c1.nScaling), int(c2.nScaling));
+        UTEST_ASSERT(c1.nInt == 1);
+        UTEST_ASSERT(c2.nInt == 1);
+        UTEST_ASSERT(c1.nScaling == 1);
+        UTEST_ASSERT(c2.nScaling == 1);
+        UTEST_ASSERT(c1.ivalue()->get() == 4000);
+        UTEST_ASSERT(c2.ivalue()->get() == 4000);
+        UTEST_ASSERT(float_equals_adaptive(c1.scaling()->get(), 2.0f));
+        UTEST_ASSERT(float_equals_adaptive(c2.scaling()->get(), 2.0f));
+
+        // Clients of parent styles should be notified first
+        UTEST_ASSERT(log.size() == 2);
+        UTEST_ASSERT(log.uget(0) == &c2);
+        UTEST_ASSERT(log.uget(1) == &c1);
+
+        // Destroy the style pending for notification while delivering the batch
+        KillerClient killer("TestBase", &sSchema, &log);
+        StyleClient *victim = new StyleClient("TestChild", &sSchema, &log);
+        UTEST_ASSERT(victim != NULL);
+        UTEST_ASSERT(killer.init() == STATUS_OK);
+        UTEST_ASSERT(victim->init() == STATUS_OK);
+        killer.pVictim  = victim;
+
+        killer.reset();
+        UTEST_ASSERT(sSchema.begin() == STATUS_OK);
+        {
+            UTEST_ASSERT(victim->style()->set_int("int", 5000) == STATUS_OK);
+            UTEST_ASSERT(killer.style()->set_int("int", 6000) == STATUS_OK);
+        }
+        UTEST_ASSERT(sSchema.end() == STATUS_OK);
+        UTEST_ASSERT(killer.nInt == 1);
+        UTEST_ASSERT(killer.pVictim == NULL);
+        UTEST_ASSERT(killer.ivalue()->get() == 6000);
+    }
+
+UTEST_END
@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-tk-lib
+ * Created on: 18 окт. 2026 г.
+ *
+ * lsp-tk-lib is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-tk-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-tk-lib. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/tk/tk.h>
+#include <lsp-plug.in/lltl/parray.h>
+
+#define SURFACE_BYTES(w, h)     (size_t(w) * size_t(h) * sizeof(uint32_t))
+
+UTEST_BEGIN("tk.sys", surfacepool)
+
+    tk::Widget *create_widget(tk::Display *dpy, lltl::parray<tk::Widget> &widgets)
+    {
+        tk::Void *w = new tk::Void(dpy);
+        if (w == NULL)
+            return NULL;
+        if (!widgets.add(w))
+        {
+            delete w;
+            return NULL;
+        }
+        if (w->init() != STATUS_OK)
+            return NULL;
+
+        w->commit_redraw();
+        return w;
+    }
+
+    void check_stats(tk::SurfacePool *pool, size_t used, size_t used_bytes, size_t free, size_t free_bytes)
+    {
+        tk::surface_pool_stats_t stats;
+        pool->get_stats(&stats);
+        printf("  used=%d (%d bytes), free=%d (%d bytes), allocated=%d, reused=%d, evicted=%d\n",
+            int(stats.nUsed), int(stats.nUsedBytes), int(stats.nFree), int(stats.nFreeBytes),
+            int(stats.nAllocated), int(stats.nReused), int(stats.nEvicted));
+
+        UTEST_ASSERT(stats.nUsed == used);
+        UTEST_ASSERT(stats.nUsedBytes == used_bytes);
+        UTEST_ASSERT(stats.nFree == free);
+        UTEST_ASSERT(stats.nFreeBytes == free_bytes);
+    }
+
+    void test_size_classes()
+    {
+        printf("Testing size classes...\n");
+        UTEST_ASSERT(tk::SurfacePool::size_class(1) == 32);
+        UTEST_ASSERT(tk::SurfacePool::size_class(32) == 32);
+        UTEST_ASSERT(tk::SurfacePool::size_class(33) == 64);
+        UTEST_ASSERT(tk::SurfacePool::size_class(300) == 320);
+        UTEST_ASSERT(tk::SurfacePool::size_class(1100) == 1152);
+    }
+
+    void test_reuse(tk::Display *dpy, ws::ISurface *factory, lltl::parray<tk::Widget> &widgets)
+    {
+        printf("Testing reuse of surfaces...\n");
+        tk::SurfacePool pool;
+        tk::surface_pool_stats_t stats;
+        pool.set_budget(0);
+
+        tk::Widget *w1 = create_widget(dpy, widgets);
+        tk::Widget *w2 = create_widget(dpy, widgets);
+        tk::Widget *w3 = create_widget(dpy, widgets);
+        UTEST_ASSERT((w1 != NULL) && (w2 != NULL) && (w3 != NULL));
+
+        // Allocate surface of the size class
+        ws::ISurface *s1 = pool.acquire(w1, factory, 40, 40, false);
+        UTEST_ASSERT(s1 != NULL);
+        UTEST_ASSERT((s1->width() == 64) && (s1->height() == 64));
+        UTEST_ASSERT(tk::SurfacePool::fits(s1, 50, 60, false));
+        UTEST_ASSERT(!tk::SurfacePool::fits(s1, 50, 60, true));
+        check_stats(&pool, 1, SURFACE_BYTES(64, 64), 0, 0);
+
+        // Release the surface to the pool
+        pool.release(s1);
+        check_stats(&pool, 0, 0, 1, SURFACE_BYTES(64, 64));
+
+        // The surface of the same size class should be reused
+        ws::ISurface *s2 = pool.acquire(w2, factory, 50, 60, false);
+        UTEST_ASSERT(s2 == s1);
+        check_stats(&pool, 1, SURFACE_BYTES(64, 64), 0, 0);
+
+        // The surface of another size class should be allocated
+        ws::ISurface *s3 = pool.acquire(w3, factory, 100, 40, false);
+        UTEST_ASSERT(s3 != NULL);
+        UTEST_ASSERT(s3 != s2);
+        UTEST_ASSERT((s3->width() == 128) && (s3->height() == 64));
+
+        // Exact surface should not be taken from the size class
+        pool.release(s3);
+        ws::ISurface *s4 = pool.acquire(w1, factory, 100, 40, true);
+        UTEST_ASSERT(s4 != NULL);
+        UTEST_ASSERT((s4->width() == 100) && (s4->height() == 40));
+        check_stats(&pool, 2, SURFACE_BYTES(64, 64) + SURFACE_BYTES(100, 40), 1, SURFACE_BYTES(128, 64));
+
+        pool.get_stats(&stats);
+        UTEST_ASSERT(stats.nAllocated == 3);
+        UTEST_ASSERT(stats.nReused == 1);
+        UTEST_ASSERT(stats.nEvicted == 0);
+
+        // Flush free surfaces
+        pool.flush();
+        check_stats(&pool, 2, SURFACE_BYTES(64, 64) + SURFACE_BYTES(100, 40), 0, 0);
+
+        pool.release(s2);
+        pool.release(s4);
+        pool.destroy();
+        check_stats(&pool, 0, 0, 0, 0);
+    }
+
+    void test_eviction(tk::Display *dpy, ws::ISurface *factory, lltl::parray<tk::Widget> &widgets)
+    {
+        printf("Testing eviction of surfaces...\n");
+        tk::SurfacePool pool;
+        tk::surface_pool_stats_t stats;
+        const size_t small = SURFACE_BYTES(64, 64);
+        const size_t large = SURFACE_BYTES(128, 128);
+        pool.set_budget(small * 2);
+
+        tk::Widget *w1 = create_widget(dpy, widgets);
+        tk::Widget *w2 = create_widget(dpy, widgets);
+        tk::Widget *w3 = create_widget(dpy, widgets);
+        tk::Widget *w4 = create_widget(dpy, widgets);
+        UTEST_ASSERT((w1 != NULL) && (w2 != NULL) && (w3 != NULL) && (w4 != NULL));
+
+        // Surfaces of widgets drawn in the current frame are not evicted
+        UTEST_ASSERT(pool.acquire(w1, factory, 64, 64, false) != NULL);
+        UTEST_ASSERT(pool.acquire(w2, factory, 64, 64, false) != NULL);
+        UTEST_ASSERT(pool.acquire(w3, factory, 64, 64, false) != NULL);
+        check_stats(&pool, 3, small * 3, 0, 0);
+        UTEST_ASSERT(!w1->redraw_pending());
+        UTEST_ASSERT(!w2->redraw_pending());
+        UTEST_ASSERT(!w3->redraw_pending());
+
+        // After the frame the least recently used surface is evicted
+        pool.next_frame();
+        pool.trim();
+        check_stats(&pool, 2, small * 2, 0, 0);
+        pool.get_stats(&stats);
+        UTEST_ASSERT(stats.nEvicted == 1);
+        UTEST_ASSERT(w1->redraw_pending() || w2->redraw_pending() || w3->redraw_pending());
+
+        // Free surfaces are dropped before evicting used ones
+        w1->commit_redraw();
+        w2->commit_redraw();
+        w3->commit_redraw();
+        pool.set_budget(small * 2 + large);
+        ws::ISurface *s = pool.acquire(w4, factory, 128, 128, false);
+        UTEST_ASSERT(s != NULL);
+        check_stats(&pool, 3, small * 2 + large, 0, 0);
+        pool.release(s);
+        check_stats(&pool, 2, small * 2, 1, large);
+        pool.set_budget(small * 2);
+        check_stats(&pool, 2, small * 2, 0, 0);
+        pool.get_stats(&stats);
+        UTEST_ASSERT(stats.nEvicted == 1);
+
+        // Surfaces of hidden widgets are evicted first
+        pool.set_budget(small * 3);
+        UTEST_ASSERT(pool.acquire(w4, factory, 64, 64, false) != NULL);
+        check_stats(&pool, 3, small * 3, 0, 0);
+        w4->visibility()->set(false);
+        w4->commit_redraw();
+        pool.set_budget(small * 2);
+        check_stats(&pool, 2, small * 2, 0, 0);
+        pool.get_stats(&stats);
+        UTEST_ASSERT(stats.nEvicted == 2);
+        UTEST_ASSERT(w4->redraw_pending());
+        UTEST_ASSERT(!w1->redraw_pending());
+        UTEST_ASSERT(!w2->redraw_pending());
+        UTEST_ASSERT(!w3->redraw_pending());
+
+        pool.destroy();
+    }
+
+    void test_window(tk::Display *dpy, ws::ISurface *factory, lltl::parray<tk::Widget> &widgets)
+    {
+        printf("Testing window back buffers...\n");
+        tk::SurfacePool pool;
+        tk::surface_pool_stats_t stats;
+        const size_t small = SURFACE_BYTES(64, 64);
+        const size_t large = SURFACE_BYTES(512, 512);
+        pool.set_budget(small * 2);
+
+        tk::Window *wnd = new tk::Window(dpy);
+        UTEST_ASSERT(wnd != NULL);
+        UTEST_ASSERT(widgets.add(wnd));
+        UTEST_ASSERT(wnd->init() == STATUS_OK);
+
+        tk::Widget *w1 = create_widget(dpy, widgets);
+        tk::Widget *w2 = create_widget(dpy, widgets);
+        UTEST_ASSERT((w1 != NULL) && (w2 != NULL));
+
+        // Back buffer of the window does not count toward the budget
+        ws::ISurface *bs = pool.acquire(wnd, factory, 512, 512, false);
+        UTEST_ASSERT(bs != NULL);
+        UTEST_ASSERT(pool.acquire(w1, factory, 64, 64, false) != NULL);
+        UTEST_ASSERT(pool.acquire(w2, factory, 64, 64, false) != NULL);
+        check_stats(&pool, 2, small * 2, 0, 0);
+        pool.get_stats(&stats);
+        UTEST_ASSERT(stats.nWindow == 1);
+        UTEST_ASSERT(stats.nWindowBytes == large);
+
+        // Widget surfaces within the budget survive the next frame
+        w1->commit_redraw();
+        w2->commit_redraw();
+        pool.next_frame();
+        pool.trim();
+        check_stats(&pool, 2, small * 2, 0, 0);
+        pool.get_stats(&stats);
+        UTEST_ASSERT(stats.nEvicted == 0);
+        UTEST_ASSERT(!w1->redraw_pending());
+        UTEST_ASSERT(!w2->redraw_pending());
+
+        // The back buffer is never evicted
+        pool.set_budget(small);
+        pool.get_stats(&stats);
+        UTEST_ASSERT(stats.nEvicted == 1);
+        UTEST_ASSERT(stats.nWindow == 1);
+        UTEST_ASSERT(stats.nWindowBytes == large);
+
+        // Released back buffer becomes an ordinary free surface
+        pool.set_budget(0);
+        pool.release(bs);
+        check_stats(&pool, 1, small, 1, large);
+        pool.get_stats(&stats);
+        UTEST_ASSERT(stats.nWindow == 0);
+        UTEST_ASSERT(stats.nWindowBytes == 0);
+
+        pool.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        lltl::parray<tk::Widget> widgets;
+
+        tk::display_settings_t settings;
+        settings.headless   = true;
+        tk::Display *dpy    = new tk::Display(&settings);
+        UTEST_ASSERT(dpy != NULL);
+        UTEST_ASSERT(dpy->init(0, NULL) == STATUS_OK);
+
+        ws::ISurface *factory = dpy->create_surface(16, 16);
+        UTEST_ASSERT(factory != NULL);
+
+        test_size_classes();
+        test_reuse(dpy, factory, widgets);
+        test_eviction(dpy, factory, widgets);
+        test_window(dpy, factory, widgets);
+
+        factory->destroy();
+        delete factory;
+
+        for (size_t i=widgets.size(); i > 0; --i)
+        {
+            tk::Widget *w = widgets.uget(i - 1);
+            w->destroy();
+            delete w;
+        }
+        widgets.flush();
+
+        dpy->destroy();
+        delete dpy;
+    }
+
+UTEST_END